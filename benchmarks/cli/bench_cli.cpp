@@ -0,0 +1,585 @@
+
+/**
+ * @file    bench_cli.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * MINBASECLI core hot paths benchmark. It drives the CLI core through the
+ * in-memory loopback HAL (no device, terminal nor thread behind it), so the
+ * results just depend on the core code and they can be compared between
+ * commits to catch regressions. It measures:
+ *
+ * - manage() command lines parsing speed (lines per second).
+ * - run() time per command line (parsing and dispatch) against the number
+ *   of added commands and the position of the received command in them.
+ * - printf() (and print()) output speed for each conversion.
+ * - cmd_help() time with a full commands table.
+ * - Latency from the reception of the last character of a command line to
+ *   the call of its callback.
+ *
+ * Each measurement is repeated BENCH_REPEATS times with the same input and
+ * the best result is reported (the one with less noise from the system).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C/C++ libraries
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// MinBaseCLI Core and In-Memory Loopback HAL
+#include "minbasecli.h"
+#include "minbasecli_impl.h"
+#include "hal/loopback/minbasecli_loopback.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+// Number of times that each measurement is repeated (best one reported)
+#if !defined(BENCH_REPEATS)
+    #define BENCH_REPEATS 5
+#endif
+
+// Number of command lines of each parse, dispatch and latency measurement
+static const uint32_t BENCH_LINES = 20000U;
+
+// Number of calls of each printf() and cmd_help() measurement
+static const uint32_t BENCH_PRINTS = 200000U;
+static const uint32_t BENCH_HELPS = 2000U;
+
+// Input buffer size (enough for BENCH_LINES lines of 64 characters)
+static const size_t BENCH_INPUT_SIZE = 64U * 20000U;
+
+// Number of commands of the dispatch measurements tables
+static const uint8_t BENCH_TABLE_SIZES[] = { 1U, 8U, 32U, 128U };
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// Benchmark CLI configuration (default buffers with the maximum number of
+// commands that can be added)
+typedef MINBASECLI_CONFIG<MINBASECLI_MAX_READ_SIZE, MINBASECLI_MAX_CMD_LEN,
+        MINBASECLI_MAX_TX_SIZE, 128U, MINBASECLI_MAX_CMD_DESCRIPTION>
+        BENCH_CONFIG;
+
+// Benchmark CLI
+typedef MINBASECLI_CORE<MINBASECLI_LOOPBACK, BENCH_CONFIG> BENCH_CLI;
+
+// Measurement function (it returns the measured time in nanoseconds)
+typedef uint64_t (*t_bench_measure)(BENCH_CLI* Cli, const void* arg);
+
+// printf() measurement format string and argument (its type is 0 for int,
+// 1 for long long, 2 for double and 3 for string)
+typedef struct t_bench_print
+{
+    const char* fstr;
+    int64_t num;
+    double fnum;
+    const char* str;
+    uint8_t arg_type;
+} t_bench_print;
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+// Input command lines
+static char bench_input[BENCH_INPUT_SIZE];
+static size_t bench_input_len = 0U;
+static uint32_t bench_input_num = 0U;
+
+// Commands callbacks calls counter and last callback call time
+static volatile uint32_t bench_calls = 0U;
+static volatile uint64_t bench_cb_time_ns = 0U;
+
+// Added commands texts
+static char bench_cmd_names[128][8];
+
+/*****************************************************************************/
+
+/* Timing */
+
+/**
+ * @details
+ * Get the monotonic clock time in nanoseconds.
+ */
+static uint64_t bench_time_ns()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)(ts.tv_sec) * 1000000000ULL) + (uint64_t)(ts.tv_nsec);
+}
+
+/**
+ * @details
+ * Run a measurement BENCH_REPEATS times and get the best (lowest) time.
+ */
+static uint64_t bench_best(t_bench_measure measure, BENCH_CLI* Cli,
+        const void* arg)
+{
+    uint64_t best = UINT64_MAX;
+    uint64_t t = 0U;
+
+    for (uint32_t i = 0U; i < BENCH_REPEATS; i++)
+    {
+        t = measure(Cli, arg);
+        if (t < best)
+        {   best = t;   }
+    }
+
+    return best;
+}
+
+/*****************************************************************************/
+
+/* Commands Callbacks */
+
+static void cmd_bench(BENCH_CLI* Cli, int argc, char* argv[])
+{
+    (void)(Cli);
+    (void)(argv);
+    bench_calls = bench_calls + (uint32_t)(argc);
+}
+
+static void cmd_latency(BENCH_CLI* Cli, int argc, char* argv[])
+{
+    (void)(Cli);
+    (void)(argc);
+    (void)(argv);
+    bench_cb_time_ns = bench_time_ns();
+}
+
+/*****************************************************************************/
+
+/* Benchmark Helpers */
+
+/**
+ * @details
+ * Fill the input buffer with a command line repeated a number of times (up
+ * to the input buffer size) and get the number of lines.
+ */
+static uint32_t bench_input_lines(const char* line, const uint32_t lines)
+{
+    size_t line_len = strlen(line);
+    uint32_t n = 0U;
+
+    bench_input_len = 0U;
+    while ( (n < lines) &&
+            ((bench_input_len + line_len) <= BENCH_INPUT_SIZE) )
+    {
+        memcpy(&(bench_input[bench_input_len]), line, line_len);
+        bench_input_len = bench_input_len + line_len;
+        n = n + 1U;
+    }
+    bench_input_num = n;
+
+    return n;
+}
+
+/**
+ * @details
+ * Create and setup a benchmark CLI with a number of added commands (named
+ * "cmd_000", "cmd_001"...). The output is just counted by the loopback HAL
+ * (not captured).
+ */
+static BENCH_CLI* bench_cli_create(const uint8_t num_commands)
+{
+    BENCH_CLI* Cli = new BENCH_CLI();
+    char description[48];
+
+    Cli->setup();
+    Cli->set_output(NULL, 0U);
+    for (uint8_t i = 0U; i < num_commands; i++)
+    {
+        ::snprintf(bench_cmd_names[i], sizeof(bench_cmd_names[i]),
+                "cmd_%03u", (unsigned)(i));
+        ::snprintf(description, sizeof(description),
+                "Benchmark command number %u of the table.", (unsigned)(i));
+        if (Cli->add_cmd(bench_cmd_names[i], cmd_bench, description) == false)
+        {   printf("Error: Can't add command %s\n", bench_cmd_names[i]);   }
+    }
+
+    return Cli;
+}
+
+/*****************************************************************************/
+
+/* Measurements */
+
+/**
+ * @details
+ * Parse all the input lines with manage().
+ */
+static uint64_t measure_manage(BENCH_CLI* Cli, const void* arg)
+{
+    BENCH_CLI::t_result result;
+    uint64_t t_start = 0U;
+    (void)(arg);
+
+    Cli->set_input(bench_input, bench_input_len);
+    t_start = bench_time_ns();
+    while (Cli->manage(&result)) {}
+    return bench_time_ns() - t_start;
+}
+
+/**
+ * @details
+ * Parse and dispatch all the input lines with run() (one line each call, so
+ * lines of unknown commands are handled too).
+ */
+static uint64_t measure_run(BENCH_CLI* Cli, const void* arg)
+{
+    uint64_t t_start = 0U;
+    (void)(arg);
+
+    Cli->set_input(bench_input, bench_input_len);
+    t_start = bench_time_ns();
+    for (uint32_t i = 0U; i < bench_input_num; i++)
+    {   Cli->run();   }
+    return bench_time_ns() - t_start;
+}
+
+/**
+ * @details
+ * Print a number of times a value with a printf() format string (the
+ * argument is a pointer to a t_bench_print element).
+ */
+static uint64_t measure_printf(BENCH_CLI* Cli, const void* arg)
+{
+    const t_bench_print* p = (const t_bench_print*)(arg);
+    uint64_t t_start = bench_time_ns();
+
+    for (uint32_t i = 0U; i < BENCH_PRINTS; i++)
+    {
+        if (p->arg_type == 0U)
+        {   Cli->printf(p->fstr, (int)(p->num) + (int)(i & 0xFFU));   }
+        else if (p->arg_type == 1U)
+        {   Cli->printf(p->fstr, (long long)(p->num) + (long long)(i));   }
+        else if (p->arg_type == 2U)
+        {   Cli->printf(p->fstr, p->fnum + (double)(i & 0xFFU));   }
+        else
+        {   Cli->printf(p->fstr, p->str);   }
+    }
+    Cli->flush();
+
+    return bench_time_ns() - t_start;
+}
+
+#if (__cplusplus >= 201402L)
+
+/**
+ * @details
+ * Print a number of times a value with print() (format string checked and
+ * parsed at compile-time).
+ */
+static uint64_t measure_print_d(BENCH_CLI* Cli, const void* arg)
+{
+    uint64_t t_start = bench_time_ns();
+    (void)(arg);
+
+    for (uint32_t i = 0U; i < BENCH_PRINTS; i++)
+    {   Cli->print(MINBASECLI_FMT("%d\n"), 1000000 + (int)(i & 0xFFU));   }
+    Cli->flush();
+
+    return bench_time_ns() - t_start;
+}
+
+static uint64_t measure_print_f(BENCH_CLI* Cli, const void* arg)
+{
+    uint64_t t_start = bench_time_ns();
+    (void)(arg);
+
+    for (uint32_t i = 0U; i < BENCH_PRINTS; i++)
+    {   Cli->print(MINBASECLI_FMT("%.3f\n"), 273.15 + (double)(i & 0xFFU));   }
+    Cli->flush();
+
+    return bench_time_ns() - t_start;
+}
+
+#endif
+
+/**
+ * @details
+ * Show the full commands list with cmd_help().
+ */
+static uint64_t measure_help(BENCH_CLI* Cli, const void* arg)
+{
+    uint64_t t_start = bench_time_ns();
+    (void)(arg);
+
+    for (uint32_t i = 0U; i < BENCH_HELPS; i++)
+    {
+        Cli->cmd_help(0, NULL);
+        Cli->flush();
+    }
+
+    return bench_time_ns() - t_start;
+}
+
+/**
+ * @details
+ * Receive the characters of a "lat" command line in two chunks (the line
+ * without its End-Of-Line, handled by a first run(), and then the '\n'), and
+ * get the time from the reception of the '\n' to the callback call.
+ */
+static uint64_t measure_latency(BENCH_CLI* Cli, const void* arg)
+{
+    static const char line[] = "lat 1 2";
+    uint64_t latency = 0U;
+    uint64_t t_start = 0U;
+    (void)(arg);
+
+    for (uint32_t i = 0U; i < BENCH_LINES; i++)
+    {
+        Cli->set_input(line, sizeof(line) - 1U);
+        Cli->run();
+        Cli->set_input("\n", 1U);
+        t_start = bench_time_ns();
+        Cli->run();
+        latency = latency + (bench_cb_time_ns - t_start);
+    }
+
+    return latency;
+}
+
+/*****************************************************************************/
+
+/* Reports */
+
+/**
+ * @details
+ * Print a result line with the time per operation and the operations per
+ * second.
+ */
+static void bench_report(const char* name, const uint64_t t_ns,
+        const uint32_t ops, const char* op_name)
+{
+    double ns_per_op = (double)(t_ns) / (double)(ops);
+    double ops_per_s = 0.0;
+
+    // A time below the clock resolution has no meaningful rate
+    if (t_ns > 0U)
+    {   ops_per_s = 1000000000.0 / ns_per_op;   }
+
+    printf("  %-34s %10.1f ns/%-5s %12.0f %s/s\n", name, ns_per_op,
+            op_name, ops_per_s, op_name);
+}
+
+/**
+ * @details
+ * Print a printf() result line with the time per call and the output bytes
+ * per second.
+ */
+static void bench_report_bytes(const char* name, const uint64_t t_ns,
+        const uint64_t bytes)
+{
+    printf("  %-34s %10.1f ns/call  %9.1f MB/s\n", name,
+            (double)(t_ns) / (double)(BENCH_PRINTS),
+            ((double)(bytes) * 1000.0) / (double)(t_ns));
+}
+
+/*****************************************************************************/
+
+/* Benchmarks */
+
+static void bench_manage()
+{
+    static const char* lines[] =
+    {
+        "ping\n",
+        "set pin 13 high\n",
+        "config net 192.168.1.10 255.255.255.0 gw 192.168.1.1 dns 8.8.8\n",
+        "cmd\tsep  by   multiple \t spaces\r\n"
+    };
+    BENCH_CLI* Cli = bench_cli_create(8U);
+    char name[64];
+    uint32_t n = 0U;
+
+    printf("manage() command lines parsing:\n");
+    for (size_t i = 0U; i < sizeof(lines) / sizeof(lines[0]); i++)
+    {
+        n = bench_input_lines(lines[i], BENCH_LINES);
+        ::snprintf(name, sizeof(name), "%u chars line",
+                (unsigned)(strlen(lines[i])));
+        bench_report(name, bench_best(measure_manage, Cli, NULL), n, "line");
+    }
+    printf("\n");
+
+    delete Cli;
+}
+
+static void bench_dispatch()
+{
+    static const char* positions[] = { "first", "middle", "last" };
+    BENCH_CLI* Cli = NULL;
+    char line[32];
+    char name[64];
+    uint32_t n = 0U;
+    uint8_t num_commands = 0U;
+    uint8_t cmd = 0U;
+    uint8_t last_cmd = 0U;
+
+    printf("run() parsing and dispatch:\n");
+    for (size_t i = 0U; i < sizeof(BENCH_TABLE_SIZES); i++)
+    {
+        num_commands = BENCH_TABLE_SIZES[i];
+        Cli = bench_cli_create(num_commands);
+        for (uint8_t pos = 0U; pos < 4U; pos++)
+        {
+            if (pos < 3U)
+            {
+                // Skip the positions that are the same command as the
+                // previous one (i.e. with a single command)
+                cmd = (uint8_t)(((num_commands - 1U) * pos) / 2U);
+                if ( (pos > 0U) && (cmd == last_cmd) )
+                {   continue;   }
+                last_cmd = cmd;
+                ::snprintf(line, sizeof(line), "%s 1\n",
+                        bench_cmd_names[cmd]);
+                ::snprintf(name, sizeof(name), "%3u commands, %s",
+                        (unsigned)(num_commands), positions[pos]);
+            }
+            else
+            {
+                ::snprintf(line, sizeof(line), "unknown 1\n");
+                ::snprintf(name, sizeof(name), "%3u commands, not found",
+                        (unsigned)(num_commands));
+            }
+            n = bench_input_lines(line, BENCH_LINES);
+            bench_report(name, bench_best(measure_run, Cli, NULL), n,
+                    "line");
+        }
+        delete Cli;
+    }
+    printf("\n");
+}
+
+static void bench_printf()
+{
+    static const t_bench_print prints[] =
+    {
+        { "literal text only\n", 0, 0.0, NULL, 0U },
+        { "%d\n", 1000000, 0.0, NULL, 0U },
+        { "%u\n", 1000000, 0.0, NULL, 0U },
+        { "%x\n", 0x7FFF0000, 0.0, NULL, 0U },
+        { "%08X\n", 0x7FFF0000, 0.0, NULL, 0U },
+        { "%o\n", 1000000, 0.0, NULL, 0U },
+        { "%lld\n", 1000000000000000LL, 0.0, NULL, 1U },
+        { "%c\n", 'A', 0.0, NULL, 0U },
+        { "%s\n", 0, 0.0, "a string argument", 3U },
+        { "%-24s|\n", 0, 0.0, "padded", 3U },
+        { "%f\n", 0, 273.15, NULL, 2U },
+        { "%.3f\n", 0, 273.15, NULL, 2U }
+    };
+    BENCH_CLI* Cli = bench_cli_create(1U);
+    char name[64];
+    uint64_t bytes = 0U;
+    uint64_t t = 0U;
+
+    printf("printf() output:\n");
+    for (size_t i = 0U; i < sizeof(prints) / sizeof(prints[0]); i++)
+    {
+        bytes = Cli->get_output_bytes();
+        t = bench_best(measure_printf, Cli, &(prints[i]));
+        bytes = (Cli->get_output_bytes() - bytes) / BENCH_REPEATS;
+        ::snprintf(name, sizeof(name), "printf(\"%.*s\")",
+                (int)(strlen(prints[i].fstr) - 1U), prints[i].fstr);
+        bench_report_bytes(name, t, bytes);
+    }
+#if (__cplusplus >= 201402L)
+    bytes = Cli->get_output_bytes();
+    t = bench_best(measure_print_d, Cli, NULL);
+    bytes = (Cli->get_output_bytes() - bytes) / BENCH_REPEATS;
+    bench_report_bytes("print(MINBASECLI_FMT(\"%d\"))", t, bytes);
+    bytes = Cli->get_output_bytes();
+    t = bench_best(measure_print_f, Cli, NULL);
+    bytes = (Cli->get_output_bytes() - bytes) / BENCH_REPEATS;
+    bench_report_bytes("print(MINBASECLI_FMT(\"%.3f\"))", t, bytes);
+#endif
+    printf("\n");
+
+    delete Cli;
+}
+
+static void bench_help()
+{
+    BENCH_CLI* Cli = bench_cli_create(128U);
+    uint64_t bytes = Cli->get_output_bytes();
+    uint64_t t = bench_best(measure_help, Cli, NULL);
+
+    bytes = (Cli->get_output_bytes() - bytes) / (BENCH_REPEATS * BENCH_HELPS);
+    printf("cmd_help() with a full table (128 commands, %u bytes):\n",
+            (unsigned)(bytes));
+    bench_report("help", t, BENCH_HELPS, "call");
+    printf("\n");
+
+    delete Cli;
+}
+
+static void bench_latency()
+{
+    BENCH_CLI* Cli = bench_cli_create(32U);
+
+    Cli->add_cmd("lat", cmd_latency, "Latency command.");
+    printf("Latency from End-Of-Line reception to callback call:\n");
+    bench_report("33 commands, \"lat 1 2\"",
+            bench_best(measure_latency, Cli, NULL), BENCH_LINES, "line");
+    printf("\n");
+
+    delete Cli;
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    printf("MINBASECLI core benchmark (best of %u runs)\n\n",
+            (unsigned)(BENCH_REPEATS));
+
+    bench_manage();
+    bench_dispatch();
+    bench_printf();
+    bench_help();
+    bench_latency();
+
+    if (bench_calls == 0U)
+    {
+        printf("Error: No command callback has been called\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+/*****************************************************************************/
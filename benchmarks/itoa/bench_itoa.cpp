@@ -0,0 +1,428 @@
+
+/**
+ * @file    bench_itoa.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * MINBASECLI integer to text conversion benchmark. It compares the previous
+ * implementation (one 64 bits division per digit and a string reverse pass)
+ * against the minbasecli_itoa.h kernels for several sets of numbers. On a
+ * host it reports nanoseconds per conversion (clock_gettime()), and on AVR
+ * devices (i.e. an ATmega328P under simavr) it reports CPU cycles per
+ * conversion (Timer1 without prescaler) through the UART.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C/C++ libraries
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+// Conversion kernels
+#include "minbasecli_itoa.h"
+
+// Device/System timing and output
+#if defined(__AVR)
+    #include <avr/io.h>
+    #include <avr/interrupt.h>
+    #include <util/atomic.h>
+#else
+    #include <stdio.h>
+    #include <time.h>
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+// Number of conversions of each benchmark set
+#if defined(__AVR)
+    static const uint32_t BENCH_CONVERSIONS_32 = 2000U;
+    static const uint32_t BENCH_CONVERSIONS_64 = 200U;
+#else
+    static const uint32_t BENCH_CONVERSIONS_32 = 20000000U;
+    static const uint32_t BENCH_CONVERSIONS_64 = 5000000U;
+#endif
+
+// Legacy implementation 64 bits number string length
+static const uint8_t MAX_64_BIT_NUM_STR_LENGTH = 21;
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// Benchmark number set generation
+typedef enum t_bench_set
+{
+    BENCH_SET_SMALL = 0,
+    BENCH_SET_U32 = 1,
+    BENCH_SET_U64 = 2
+} t_bench_set;
+
+// Conversion function under test
+typedef uint8_t (*t_bench_conv)(const uint64_t num, char* str,
+        const uint8_t base);
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+// Conversions output checksum (so the conversions are not optimized out)
+static volatile uint32_t bench_sink = 0U;
+
+#if defined(__AVR)
+    // Timer1 overflows counter
+    static volatile uint16_t timer1_overflows = 0U;
+#endif
+
+/*****************************************************************************/
+
+/* Legacy Implementation */
+
+/**
+ * @details
+ * Copy of the previous MINBASECLI::str_reverse() (temporary buffer enlarged
+ * to 23 characters, so 64 bits octal numbers doesn't overflow it).
+ */
+static bool legacy_str_reverse(char* str, uint8_t length)
+{
+    char tmp[23];
+    int8_t start = 0;
+    int8_t end = length - 1;
+
+    if (length == 0)
+    {   return false;   }
+
+    memcpy(tmp, str, length);
+    while (start < end)
+    {
+        *(str + start) = *(tmp + end);
+        *(str + end) = *(tmp + start);
+        start = start + 1;
+        end = end - 1;
+    }
+
+    return true;
+}
+
+/**
+ * @details
+ * Copy of the previous MINBASECLI::u64toa().
+ */
+static bool legacy_u64toa(uint64_t num, char* str,
+        const uint8_t str_size, const uint8_t base)
+{
+    uint64_t tmp;
+    uint8_t i = 0;
+
+    // Check if string buffer max size is large enough for 64 bits num
+    if (str_size < MAX_64_BIT_NUM_STR_LENGTH)
+    {   return false;   }
+
+    // Check for number 0
+    if (num == 0)
+    {
+        str[0] = '0';
+        str[1] = '\0';
+        return true;
+    }
+
+    // Process individual digits
+    while (num != 0)
+    {
+        tmp = num % base;
+        if (tmp > 9)
+            str[i] = (tmp - 10) + 'a';
+        else
+            str[i] = tmp + '0';
+        num = num / base;
+        i = i + 1;
+    }
+
+    // Null terminate string
+    str[i] = '\0';
+
+    // Reverse the string
+    legacy_str_reverse(str, i);
+
+    return true;
+}
+
+/*****************************************************************************/
+
+/* Benchmarked Conversions */
+
+/**
+ * @details
+ * Previous implementation (with the strlen() that printf() needed to get the
+ * number of digits).
+ */
+static uint8_t conv_legacy(const uint64_t num, char* str, const uint8_t base)
+{
+    legacy_u64toa(num, str, MINBASECLI_ITOA_SIZE, base);
+    return (uint8_t)(strlen(str));
+}
+
+/**
+ * @details
+ * New generic kernel (the one used by printf()).
+ */
+static uint8_t conv_kernel(const uint64_t num, char* str, const uint8_t base)
+{
+    return minbasecli_u64toa(num, str, MINBASECLI_ITOA_SIZE, base);
+}
+
+/**
+ * @details
+ * New 32 bits decimal kernel.
+ */
+static uint8_t conv_kernel_u32(const uint64_t num, char* str,
+        const uint8_t base)
+{
+    (void)(base);
+    return minbasecli_u32toa((uint32_t)(num), str);
+}
+
+/*****************************************************************************/
+
+/* Timing and Output */
+
+#if defined(__AVR)
+
+ISR(TIMER1_OVF_vect)
+{
+    timer1_overflows = timer1_overflows + 1U;
+}
+
+/**
+ * @details
+ * Timer1 runs without prescaler, so each count is a CPU cycle.
+ */
+static void bench_timer_setup()
+{
+    TCCR1A = 0U;
+    TCCR1B = (1U << CS10);
+    TIMSK1 = (1U << TOIE1);
+    sei();
+}
+
+static uint32_t bench_time()
+{
+    uint32_t cycles = 0U;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        cycles = TCNT1;
+        if (TIFR1 & (1U << TOV1))
+        {   cycles = TCNT1 + 0x10000UL;   }
+        cycles = cycles + ((uint32_t)(timer1_overflows) << 16);
+    }
+
+    return cycles;
+}
+
+static void bench_print(const char* str)
+{
+    while (*str != '\0')
+    {
+        while ((UCSR0A & (1U << UDRE0)) == 0U);
+        UDR0 = (uint8_t)(*str);
+        str = str + 1;
+    }
+}
+
+static void bench_output_setup()
+{
+    UBRR0H = 0U;
+    UBRR0L = 8U;
+    UCSR0B = (1U << TXEN0);
+    UCSR0C = (1U << UCSZ01) | (1U << UCSZ00);
+}
+
+#else
+
+static void bench_timer_setup()
+{}
+
+static uint32_t bench_time()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((ts.tv_sec * 1000000000LL) + ts.tv_nsec);
+}
+
+static void bench_print(const char* str)
+{
+    fputs(str, stdout);
+}
+
+static void bench_output_setup()
+{}
+
+#endif
+
+/*****************************************************************************/
+
+/* Benchmark Functions */
+
+/**
+ * @details
+ * Get the next number of a set from a pseudo-random generator (the same
+ * sequence for all the conversions under test).
+ */
+static uint64_t bench_next(uint64_t* seed, const t_bench_set set)
+{
+    *seed = (*seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+    if (set == BENCH_SET_SMALL)
+    {   return (*seed >> 33) % 10000U;   }
+    if (set == BENCH_SET_U32)
+    {   return *seed >> 32;   }
+    return *seed >> ((*seed >> 58) & 0x0FU);
+}
+
+/**
+ * @details
+ * Run a number of conversions and get the time (or cycles) of each one in
+ * hundredths, discounting the numbers generation time.
+ */
+static uint32_t bench_run(t_bench_conv conv, const t_bench_set set,
+        const uint8_t base, const uint32_t conversions)
+{
+    char str[MINBASECLI_ITOA_SIZE];
+    uint64_t seed = 1U;
+    uint64_t num = 0U;
+    uint32_t sink = 0U;
+    uint32_t t_start = 0U;
+    uint32_t t_conv = 0U;
+    uint32_t t_gen = 0U;
+
+    // Numbers generation overhead
+    t_start = bench_time();
+    for (uint32_t i = 0U; i < conversions; i++)
+    {
+        num = bench_next(&seed, set);
+        sink = sink + (uint32_t)(num);
+    }
+    t_gen = bench_time() - t_start;
+
+    // Numbers generation and conversion
+    seed = 1U;
+    t_start = bench_time();
+    for (uint32_t i = 0U; i < conversions; i++)
+    {
+        num = bench_next(&seed, set);
+        sink = sink + conv(num, str, base) + (uint8_t)(str[0]);
+    }
+    t_conv = bench_time() - t_start;
+    bench_sink = sink;
+
+    if (t_conv < t_gen)
+    {   return 0U;   }
+    return (uint32_t)((((uint64_t)(t_conv - t_gen)) * 100U) / conversions);
+}
+
+/**
+ * @details
+ * Print a benchmark result line (time with two decimals).
+ */
+static void bench_report(const char* name, const uint32_t result)
+{
+    char str[MINBASECLI_ITOA_SIZE];
+    uint8_t len = 0U;
+
+    bench_print(name);
+    len = minbasecli_u32toa(result / 100U, str);
+    str[len] = '.';
+    minbasecli_u32toa_digits(result % 100U, &(str[len + 3U]), 2U);
+    str[len + 3U] = '\0';
+    bench_print(str);
+#if defined(__AVR)
+    bench_print(" cycles\n");
+#else
+    bench_print(" ns\n");
+#endif
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    uint32_t n32 = BENCH_CONVERSIONS_32;
+    uint32_t n64 = BENCH_CONVERSIONS_64;
+
+    bench_output_setup();
+    bench_timer_setup();
+
+    bench_print("Conversion time per number\n\n");
+
+    bench_print("Decimal, 0 to 9999:\n");
+    bench_report("  legacy u64toa:       ",
+            bench_run(conv_legacy, BENCH_SET_SMALL, 10U, n32));
+    bench_report("  minbasecli_u64toa(): ",
+            bench_run(conv_kernel, BENCH_SET_SMALL, 10U, n32));
+    bench_report("  minbasecli_u32toa(): ",
+            bench_run(conv_kernel_u32, BENCH_SET_SMALL, 10U, n32));
+
+    bench_print("Decimal, 32 bits:\n");
+    bench_report("  legacy u64toa:       ",
+            bench_run(conv_legacy, BENCH_SET_U32, 10U, n32));
+    bench_report("  minbasecli_u64toa(): ",
+            bench_run(conv_kernel, BENCH_SET_U32, 10U, n32));
+    bench_report("  minbasecli_u32toa(): ",
+            bench_run(conv_kernel_u32, BENCH_SET_U32, 10U, n32));
+
+    bench_print("Decimal, 64 bits:\n");
+    bench_report("  legacy u64toa:       ",
+            bench_run(conv_legacy, BENCH_SET_U64, 10U, n64));
+    bench_report("  minbasecli_u64toa(): ",
+            bench_run(conv_kernel, BENCH_SET_U64, 10U, n64));
+
+    bench_print("Hexadecimal, 32 bits:\n");
+    bench_report("  legacy u64toa:       ",
+            bench_run(conv_legacy, BENCH_SET_U32, 16U, n32));
+    bench_report("  minbasecli_u64toa(): ",
+            bench_run(conv_kernel, BENCH_SET_U32, 16U, n32));
+
+    bench_print("Hexadecimal, 64 bits:\n");
+    bench_report("  legacy u64toa:       ",
+            bench_run(conv_legacy, BENCH_SET_U64, 16U, n64));
+    bench_report("  minbasecli_u64toa(): ",
+            bench_run(conv_kernel, BENCH_SET_U64, 16U, n64));
+
+#if defined(__AVR)
+    // Stop the simulation (sleep with interrupts disabled)
+    cli();
+    SMCR = (1U << SE);
+    __asm__ __volatile__ ("sleep");
+#endif
+
+    return 0;
+}
+
+/*****************************************************************************/
@@ -168,8 +168,8 @@ void th_cli_interpreter(void* arg)
         if (command_received)
         {   cli_interpreter(&cli_read);   }
 
-        // Some delay to free cpu usage
-        delay_ms(10);
+        // Wait for new input (without cpu usage) up to 100ms
+        Cli.wait_for_input(100);
     }
 }
 
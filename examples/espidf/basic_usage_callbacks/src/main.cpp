@@ -183,8 +183,8 @@ void th_cli_interpreter(void* arg)
         // Check and Handle CLI commands
         Cli.run();
 
-        // Some delay to free cpu usage
-        delay_ms(10);
+        // Wait for new input (without cpu usage) up to 100ms
+        Cli.wait_for_input(100);
     }
 }
 
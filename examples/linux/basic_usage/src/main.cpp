@@ -44,9 +44,6 @@
 
 /* Defines, Macros, Constants and Types */
 
-// Delay milli-seconds Macro
-#define delay_ms(x) do { usleep(x*1000); } while(0)
-
 // Current Application Version
 #define APP_VER "1.0.0"
 
@@ -127,8 +124,8 @@ int main()
             Cli.printf("\n");
         }
 
-        // Some delay to free cpu usage
-        delay_ms(10);
+        // Wait for new input (without cpu usage) up to 100ms
+        Cli.wait_for_input(100);
     }
 
     return 0;
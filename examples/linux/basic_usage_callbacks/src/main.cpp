@@ -45,9 +45,6 @@
 
 /* Defines, Macros, Constants and Types */
 
-// Delay milli-seconds Macro
-#define delay_ms(x) do { usleep(x*1000); } while(0)
-
 // Current Application Version
 #define APP_VER "1.0.0"
 
@@ -78,13 +75,10 @@ void cmd_exit(MINBASECLI* Cli, int argc, char* argv[]);
 
 /* main Function */
 
-int main()
+int main(int argc, char* argv[])
 {
     MINBASECLI Cli;
 
-    // Initialize Command Line Interface
-    Cli.setup();
-
     // Add commands and bind callbacks to them
     Cli.add_cmd("test", &cmd_test, "test [on/off] - Turn test mode ON/OFF.");
     Cli.add_cmd("version", &cmd_version, "Shows current application version.");
@@ -94,6 +88,25 @@ int main()
     // will shows added command descriptions, but you can setup a custom one
     Cli.add_cmd("help", &cmd_help, "Shows program help information.");
 
+    // Execute a script file if provided ("-" for STDIN) and exit
+    if (argc > 1)
+    {
+        t_cli_script_stats stats = { 0, 0, 0, 0 };
+
+        if (Cli.run_file(argv[1], &stats) == false)
+        {
+            fprintf(stderr, "Fail to execute script %s\n", argv[1]);
+            return 1;
+        }
+        fprintf(stderr, "Script: %" PRIu32 " lines, %" PRIu32 " commands, "
+                "%" PRIu32 " unknown, %" PRIu32 " truncated\n", stats.lines,
+                stats.commands, stats.unknown, stats.truncated);
+        return 0;
+    }
+
+    // Initialize Command Line Interface
+    Cli.setup();
+
     Cli.printf("\nCommand Line Interface is ready\n\n");
 
     while(1)
@@ -105,8 +118,8 @@ int main()
         // Check and Handle CLI commands
         Cli.run();
 
-        // Some delay to free cpu usage
-        delay_ms(10);
+        // Wait for new input (without cpu usage) up to 100ms
+        Cli.wait_for_input(100);
     }
 
     return 0;
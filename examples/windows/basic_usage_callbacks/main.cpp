@@ -47,9 +47,6 @@
 
 /* Defines, Macros, Constants and Types */
 
-// Delay milli-seconds Macro
-#define delay_ms(x) do { Sleep(x); } while(0)
-
 // Current Application Version
 #define APP_VER "1.0.0"
 
@@ -107,8 +104,8 @@ int main()
         // Check and Handle CLI commands
         Cli.run();
 
-        // Some delay to free cpu usage
-        delay_ms(10);
+        // Wait for new input (without cpu usage) up to 100ms
+        Cli.wait_for_input(100);
     }
 
     return 0;
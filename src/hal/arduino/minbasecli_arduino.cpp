@@ -42,25 +42,11 @@
 // Header Interface
 #include "minbasecli_arduino.h"
 
-// Device/Framework Libraries
-#include <Arduino.h>
-
 // Standard Libraries
 #include <string.h>
 
 /*****************************************************************************/
 
-/* Constants & Defines */
-
-// Interface Element Data Type
-#if defined(USBCON) // Arduinos: Leonardo, Micro, MKR, etc
-    #define _IFACE Serial_
-#else // Arduinos: UNO, MEGA, Nano, etc
-    #define _IFACE HardwareSerial
-#endif
-
-/*****************************************************************************/
-
 /* Constructor */
 
 /**
@@ -95,34 +81,64 @@ bool MINBASECLI_ARDUINO::hal_setup(void* iface, const uint32_t baud_rate)
 
 /**
  * @details
- * This function return the number of bytes received by the interface that are
- * available to be read.
+ * This function polls the interface until there is received data available
+ * to be read or the timeout expires (there is no wait mechanism available),
+ * yielding the CPU to other framework tasks while it waits.
  */
-size_t MINBASECLI_ARDUINO::hal_iface_available()
+bool MINBASECLI_ARDUINO::hal_iface_wait(const uint32_t timeout_ms)
 {
     _IFACE* _Serial = (_IFACE*) this->iface;
-    return ((size_t) (_Serial->available()));
+    uint32_t t0 = millis();
+
+    while (_Serial->available() == 0)
+    {
+        if ((uint32_t)(millis() - t0) >= timeout_ms)
+        {   return false;   }
+        yield();
+    }
+
+    return true;
 }
 
 /**
  * @details
- * This function returns a received byte from the interface.
+ * This function returns the Arduino micros() free-running time.
  */
-uint8_t MINBASECLI_ARDUINO::hal_iface_read()
+uint32_t MINBASECLI_ARDUINO::hal_time_us()
+{
+    return (uint32_t)(micros());
+}
+
+/**
+ * @details
+ * This function send a block of bytes through the interface.
+ */
+void MINBASECLI_ARDUINO::hal_iface_write(const uint8_t* data,
+        const size_t data_len)
 {
     _IFACE* _Serial = (_IFACE*) this->iface;
-    return _Serial->read();
+
+    _Serial->write(data, data_len);
 }
 
 /**
  * @details
- * This function send a byte through the interface.
+ * This function writes the part of the block of bytes that fits in the free
+ * space of the Serial transmission buffer.
  */
-void MINBASECLI_ARDUINO::hal_iface_print(const uint8_t data_byte)
+size_t MINBASECLI_ARDUINO::hal_iface_try_write(const uint8_t* data,
+        const size_t data_len)
 {
     _IFACE* _Serial = (_IFACE*) this->iface;
+    size_t write_len = data_len;
+    int free_len = _Serial->availableForWrite();
+
+    if (free_len <= 0)
+    {   return 0;   }
+    if (write_len > (size_t)(free_len))
+    {   write_len = (size_t)(free_len);   }
 
-    _Serial->write(data_byte);
+    return _Serial->write(data, write_len);
 }
 
 /*****************************************************************************/
@@ -42,6 +42,9 @@
 
 /* Libraries */
 
+// Device/Framework Libraries
+#include <Arduino.h>
+
 // Standard C/C++ libraries
 #include <stdint.h>
 #include <stdbool.h>
@@ -51,6 +54,13 @@
 
 /* Constants & Defines */
 
+// Interface Element Data Type
+#if defined(USBCON) // Arduinos: Leonardo, Micro, MKR, etc
+    #define _IFACE Serial_
+#else // Arduinos: UNO, MEGA, Nano, etc
+    #define _IFACE HardwareSerial
+#endif
+
 /*****************************************************************************/
 
 /* CLass Interface */
@@ -92,19 +102,95 @@ class MINBASECLI_ARDUINO
          * are available in the current interface buffer to be read.
          * @return size_t The number of bytes available to be read.
          */
-        size_t hal_iface_available();
+        size_t hal_iface_available()
+        {
+            _IFACE* _Serial = (_IFACE*) this->iface;
+            return ((size_t) (_Serial->available()));
+        }
 
         /**
          * @brief Get/read a byte from the interface.
          * @return uint8_t The byte read.
          */
-        uint8_t hal_iface_read();
+        uint8_t hal_iface_read()
+        {
+            _IFACE* _Serial = (_IFACE*) this->iface;
+            return _Serial->read();
+        }
+
+        /**
+         * @brief Get/read all the available bytes from the interface (up to
+         * a maximum number of bytes).
+         * @param data Pointer to the buffer to store the read bytes.
+         * @param data_max Maximum number of bytes to read.
+         * @return size_t The number of bytes read.
+         */
+        size_t hal_iface_read_bulk(uint8_t* data, const size_t data_max)
+        {
+            _IFACE* _Serial = (_IFACE*) this->iface;
+            size_t data_len = (size_t)(_Serial->available());
+
+            if (data_len > data_max)
+            {   data_len = data_max;   }
+            for (size_t i = 0U; i < data_len; i++)
+            {   data[i] = (uint8_t)(_Serial->read());   }
+
+            return data_len;
+        }
+
+        /**
+         * @brief Get the number of received bytes that have been discarded
+         * because the interface reception buffer was full.
+         * @return uint32_t The number of dropped bytes.
+         */
+        uint32_t hal_iface_rx_dropped()
+        {
+            // Not tracked by the interface driver
+            return 0;
+        }
+
+        /**
+         * @brief Wait until the interface has received data to be read, or
+         * until a timeout expires.
+         * @param timeout_ms Maximum time to wait (milliseconds).
+         * @return true if there is received data available to be read.
+         * @return false if the timeout has expired without received data.
+         */
+        bool hal_iface_wait(const uint32_t timeout_ms);
+
+        /**
+         * @brief Get a free-running monotonic time (microseconds) to measure
+         * elapsed times (it wraps around every ~71 minutes).
+         * @return uint32_t The current time (microseconds).
+         */
+        uint32_t hal_time_us();
 
         /**
          * @brief Write a byte to the interface.
          * @param data_byte The byte to be written.
          */
-        void hal_iface_print(const uint8_t data_byte);
+        void hal_iface_print(const uint8_t data_byte)
+        {
+            _IFACE* _Serial = (_IFACE*) this->iface;
+
+            _Serial->write(data_byte);
+        }
+
+        /**
+         * @brief Write a block of bytes to the interface.
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         */
+        void hal_iface_write(const uint8_t* data, const size_t data_len);
+
+        /**
+         * @brief Write a block of bytes to the interface without blocking
+         * (just the part of it that the interface can accept now).
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         * @return size_t The number of bytes written.
+         */
+        size_t hal_iface_try_write(const uint8_t* data, const size_t data_len);
 
     /*************************************************************************/
 
@@ -42,21 +42,17 @@
 // Header Interface
 #include "minbasecli_avr.h"
 
-// (UART Driver)
-#include "avr_uart.h"
+// (Delay Functions)
+#include <util/delay.h>
+
+// (UART Registers)
+#include <avr/io.h>
 
 // Standard Libraries
 #include <string.h>
 
 /*****************************************************************************/
 
-/* Constants & Defines */
-
-// Interface Element Data Type
-#define _IFACE AvrUart
-
-/*****************************************************************************/
-
 /* Constructor */
 
 /**
@@ -91,41 +87,68 @@ bool MINBASECLI_AVR::hal_setup(void* iface, const uint32_t baud_rate)
 
 /**
  * @details
- * This function return the number of bytes received by the interface that are
- * available to be read.
+ * This function polls the interface each millisecond until there is received
+ * data available to be read or the timeout expires (there is no wait
+ * mechanism available).
  */
-size_t MINBASECLI_AVR::hal_iface_available()
+bool MINBASECLI_AVR::hal_iface_wait(const uint32_t timeout_ms)
 {
     _IFACE* _Serial = (_IFACE*) this->iface;
 
-    return ((size_t) (_Serial->num_rx_data_available()));
+    for (uint32_t ms = 0U; ms < timeout_ms; ms++)
+    {
+        if (_Serial->num_rx_data_available() > 0)
+        {   return true;   }
+        _delay_ms(1);
+    }
+
+    return (_Serial->num_rx_data_available() > 0);
 }
 
 /**
  * @details
- * This function returns a received byte from the interface.
+ * This function should return a free-running time in microseconds, but there
+ * is not any timer reserved for the CLI in this HAL, so zero is always
+ * returned (time budgets are not applied on this device, and the commands
+ * calls statistics are rejected at build time).
  */
-uint8_t MINBASECLI_AVR::hal_iface_read()
+uint32_t MINBASECLI_AVR::hal_time_us()
 {
-    uint8_t read_byte = 0;
+    return 0;
+}
 
+/**
+ * @details
+ * This function send a block of bytes through the interface.
+ */
+void MINBASECLI_AVR::hal_iface_write(const uint8_t* data,
+        const size_t data_len)
+{
     _IFACE* _Serial = (_IFACE*) this->iface;
 
-    if (!_Serial->read(&read_byte))
-    {   return 0;   }
-
-    return read_byte;
+    for (size_t i = 0U; i < data_len; i++)
+    {   _Serial->write(data[i]);   }
 }
 
 /**
  * @details
- * This function send a byte through the interface.
+ * This function writes bytes of the block while the UART transmission data
+ * register is empty (the UART driver has no transmission buffer, so it
+ * accepts one byte while the previous one is being sent).
  */
-void MINBASECLI_AVR::hal_iface_print(const uint8_t data_byte)
+size_t MINBASECLI_AVR::hal_iface_try_write(const uint8_t* data,
+        const size_t data_len)
 {
     _IFACE* _Serial = (_IFACE*) this->iface;
+    size_t written = 0U;
+
+    while ( (written < data_len) && (UCSR0A & (1U << UDRE0)) )
+    {
+        _Serial->write(data[written]);
+        written = written + 1U;
+    }
 
-    _Serial->write(data_byte);
+    return written;
 }
 
 /*****************************************************************************/
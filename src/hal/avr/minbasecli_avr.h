@@ -42,6 +42,10 @@
 
 /* Libraries */
 
+// Device/Framework Libraries
+// (UART Driver)
+#include "avr_uart.h"
+
 // Standard C/C++ libraries
 #include <stdint.h>
 #include <stdbool.h>
@@ -51,11 +55,20 @@
 
 /* Constants & Defines */
 
+// Interface Element Data Type
+#define _IFACE AvrUart
+
 // Default UART number to be used
 #if !defined(MINBASECLI_UART)
     #define MINBASECLI_UART 0
 #endif
 
+// Commands calls statistics need a microseconds time, and there is not any
+// timer reserved for the CLI in this HAL (see hal_time_us())
+#if defined(MINBASECLI_CMD_STATS)
+    #error "minbasecli_avr - MINBASECLI_CMD_STATS is not supported."
+#endif
+
 /*****************************************************************************/
 
 /* CLass Interface */
@@ -97,19 +110,100 @@ class MINBASECLI_AVR
          * are available in the current interface buffer to be read.
          * @return size_t The number of bytes available to be read.
          */
-        size_t hal_iface_available();
+        size_t hal_iface_available()
+        {
+            _IFACE* _Serial = (_IFACE*) this->iface;
+
+            return ((size_t) (_Serial->num_rx_data_available()));
+        }
 
         /**
          * @brief Get/read a byte from the interface.
          * @return uint8_t The byte read.
          */
-        uint8_t hal_iface_read();
+        uint8_t hal_iface_read()
+        {
+            uint8_t read_byte = 0;
+
+            _IFACE* _Serial = (_IFACE*) this->iface;
+
+            if (!_Serial->read(&read_byte))
+            {   return 0;   }
+
+            return read_byte;
+        }
+
+        /**
+         * @brief Get/read all the available bytes from the interface (up to
+         * a maximum number of bytes).
+         * @param data Pointer to the buffer to store the read bytes.
+         * @param data_max Maximum number of bytes to read.
+         * @return size_t The number of bytes read.
+         */
+        size_t hal_iface_read_bulk(uint8_t* data, const size_t data_max)
+        {
+            _IFACE* _Serial = (_IFACE*) this->iface;
+            size_t data_len = 0U;
+
+            while ( (data_len < data_max) && _Serial->read(&(data[data_len])) )
+            {   data_len = data_len + 1U;   }
+
+            return data_len;
+        }
+
+        /**
+         * @brief Get the number of received bytes that have been discarded
+         * because the interface reception buffer was full.
+         * @return uint32_t The number of dropped bytes.
+         */
+        uint32_t hal_iface_rx_dropped()
+        {
+            // Not tracked by the interface driver
+            return 0;
+        }
+
+        /**
+         * @brief Wait until the interface has received data to be read, or
+         * until a timeout expires.
+         * @param timeout_ms Maximum time to wait (milliseconds).
+         * @return true if there is received data available to be read.
+         * @return false if the timeout has expired without received data.
+         */
+        bool hal_iface_wait(const uint32_t timeout_ms);
+
+        /**
+         * @brief Get a free-running monotonic time (microseconds) to measure
+         * elapsed times (it wraps around every ~71 minutes).
+         * @return uint32_t The current time (microseconds).
+         */
+        uint32_t hal_time_us();
 
         /**
          * @brief Write a byte to the interface.
          * @param data_byte The byte to be written.
          */
-        void hal_iface_print(const uint8_t data_byte);
+        void hal_iface_print(const uint8_t data_byte)
+        {
+            _IFACE* _Serial = (_IFACE*) this->iface;
+
+            _Serial->write(data_byte);
+        }
+
+        /**
+         * @brief Write a block of bytes to the interface.
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         */
+        void hal_iface_write(const uint8_t* data, const size_t data_len);
+
+        /**
+         * @brief Write a block of bytes to the interface without blocking
+         * (just the part of it that the interface can accept now).
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         * @return size_t The number of bytes written.
+         */
+        size_t hal_iface_try_write(const uint8_t* data, const size_t data_len);
 
     /*************************************************************************/
 
@@ -0,0 +1,306 @@
+
+/**
+ * @file    minbasecli_spsc_ring.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Lock-free Single-Producer/Single-Consumer ring buffer of bytes to be used
+ * by the HALs that receive the interface data in a different thread or task
+ * than the CLI one (i.e. Linux, Windows and ESP-IDF).
+ *
+ * The producer (read thread) and the consumer (CLI) just write their own
+ * index, with release ordering after storing or getting the data, and
+ * acquire ordering when reading the other one index. Each index is placed in
+ * its own cache line to avoid false sharing between both threads. When the
+ * ring is full, push() discards the new bytes and counts them as dropped (an
+ * interrupt can't wait), while a producer thread can use push_fit() and wait
+ * for the consumer to free space (see space_wait_begin()).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef MINBASECLI_SPSC_RING_H_
+#define MINBASECLI_SPSC_RING_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C/C++ libraries
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+
+/*****************************************************************************/
+
+/* Constants & Defines */
+
+// Cache line size to place the producer and consumer data apart
+#if !defined(MINBASECLI_CACHE_LINE_SIZE)
+    #define MINBASECLI_CACHE_LINE_SIZE 64
+#endif
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief MINBASECLI_SPSC_RING Class.
+ * Lock-free Single-Producer/Single-Consumer ring buffer of SIZE bytes.
+ * The head and tail indexes are free-running counters that are masked to
+ * access the buffer, so SIZE must be a power of two and the full buffer can
+ * be used.
+ */
+template <size_t SIZE>
+class MINBASECLI_SPSC_RING
+{
+    static_assert( (SIZE >= 2U) && ((SIZE & (SIZE - 1U)) == 0U),
+            "minbasecli - Ring buffer size must be a power of two.");
+
+    /*************************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new empty ring buffer.
+         */
+        MINBASECLI_SPSC_RING()
+        {
+            this->head.store(0U, std::memory_order_relaxed);
+            this->num_dropped.store(0U, std::memory_order_relaxed);
+            this->producer_waiting.store(false, std::memory_order_relaxed);
+            this->tail.store(0U, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Add a block of bytes to the ring (producer side). The bytes
+         * that doesn't fit in the ring are discarded and counted as dropped.
+         * @param data Pointer to the bytes to add.
+         * @param data_len Number of bytes to add.
+         * @return size_t The number of bytes added.
+         */
+        size_t push(const uint8_t* data, const size_t data_len)
+        {
+            size_t push_len = push_fit(data, data_len);
+
+            // Count the bytes that doesn't fit as dropped
+            if (push_len < data_len)
+            {
+                this->num_dropped.store((uint32_t)(
+                        this->num_dropped.load(std::memory_order_relaxed) +
+                        (data_len - push_len)), std::memory_order_relaxed);
+            }
+
+            return push_len;
+        }
+
+        /**
+         * @brief Add the part of a block of bytes that fits in the ring
+         * (producer side). The rest of the bytes are not added, so the
+         * producer can add them when the consumer frees space.
+         * @param data Pointer to the bytes to add.
+         * @param data_len Number of bytes to add.
+         * @return size_t The number of bytes added.
+         */
+        size_t push_fit(const uint8_t* data, const size_t data_len)
+        {
+            size_t h = this->head.load(std::memory_order_relaxed);
+            size_t t = this->tail.load(std::memory_order_acquire);
+            size_t free_space = SIZE - (h - t);
+            size_t push_len = data_len;
+            size_t first_len = 0U;
+
+            if (push_len > free_space)
+            {   push_len = free_space;   }
+            if (push_len == 0U)
+            {   return 0U;   }
+
+            // Copy the bytes (in two blocks if the buffer end is reached)
+            first_len = SIZE - (h & (SIZE - 1U));
+            if (first_len > push_len)
+            {   first_len = push_len;   }
+            memcpy(&(this->buffer[h & (SIZE - 1U)]), data, first_len);
+            memcpy(&(this->buffer[0]), &(data[first_len]),
+                    push_len - first_len);
+
+            // Publish the new bytes to the consumer
+            this->head.store(h + push_len, std::memory_order_release);
+
+            return push_len;
+        }
+
+        /**
+         * @brief Add a byte to the ring (producer side). The byte is
+         * discarded and counted as dropped if the ring is full.
+         * @param data_byte The byte to add.
+         * @return true if the byte has been added.
+         * @return false if the ring is full.
+         */
+        bool push(const uint8_t data_byte)
+        {
+            return (push(&data_byte, 1U) == 1U);
+        }
+
+        /**
+         * @brief Get/remove a block of bytes from the ring (consumer side).
+         * @param data Pointer to store the bytes.
+         * @param data_max Maximum number of bytes to get.
+         * @return size_t The number of bytes got.
+         */
+        size_t pop(uint8_t* data, const size_t data_max)
+        {
+            size_t t = this->tail.load(std::memory_order_relaxed);
+            size_t h = this->head.load(std::memory_order_acquire);
+            size_t pop_len = h - t;
+            size_t first_len = 0U;
+
+            if (pop_len > data_max)
+            {   pop_len = data_max;   }
+            if (pop_len == 0U)
+            {   return 0U;   }
+
+            // Copy the bytes (in two blocks if the buffer end is reached)
+            first_len = SIZE - (t & (SIZE - 1U));
+            if (first_len > pop_len)
+            {   first_len = pop_len;   }
+            memcpy(data, &(this->buffer[t & (SIZE - 1U)]), first_len);
+            memcpy(&(data[first_len]), &(this->buffer[0]),
+                    pop_len - first_len);
+
+            // Release the buffer space to the producer
+            this->tail.store(t + pop_len, std::memory_order_release);
+
+            return pop_len;
+        }
+
+        /**
+         * @brief Get/remove a byte from the ring (consumer side).
+         * @param data_byte Pointer to store the byte.
+         * @return true if a byte has been got.
+         * @return false if the ring is empty.
+         */
+        bool pop(uint8_t* data_byte)
+        {
+            return (pop(data_byte, 1U) == 1U);
+        }
+
+        /**
+         * @brief Get the number of bytes stored in the ring (consumer side).
+         * @return size_t The number of bytes available to be got.
+         */
+        size_t available() const
+        {
+            return (this->head.load(std::memory_order_acquire) -
+                    this->tail.load(std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Get the number of bytes that have been discarded because
+         * the ring was full.
+         * @return uint32_t The number of dropped bytes.
+         */
+        uint32_t dropped() const
+        {
+            return this->num_dropped.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Set that the producer is going to wait for free space and
+         * get the current free space (producer side). The producer must
+         * wait just if it is zero, and the consumer checks space_waited()
+         * after getting bytes to wake it up (the fences ensure that either
+         * the producer sees the freed space or the consumer sees the flag).
+         * @return size_t The number of bytes that can be added.
+         */
+        size_t space_wait_begin()
+        {
+            this->producer_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return (SIZE - (this->head.load(std::memory_order_relaxed) -
+                    this->tail.load(std::memory_order_acquire)));
+        }
+
+        /**
+         * @brief Set that the producer is not waiting for free space anymore
+         * (producer side).
+         */
+        void space_wait_end()
+        {
+            this->producer_waiting.store(false, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Check if the producer is waiting for free space (consumer
+         * side, after getting bytes, to wake it up).
+         * @return true if the producer is waiting for free space.
+         * @return false if it is not.
+         */
+        bool space_waited()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return this->producer_waiting.load(std::memory_order_relaxed);
+        }
+
+    /*************************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Write index (just modified by the producer).
+         */
+        alignas(MINBASECLI_CACHE_LINE_SIZE) std::atomic<size_t> head;
+
+        /**
+         * @brief Number of dropped bytes (just modified by the producer).
+         */
+        std::atomic<uint32_t> num_dropped;
+
+        /**
+         * @brief Producer waiting for free space flag (just modified by the
+         * producer).
+         */
+        std::atomic<bool> producer_waiting;
+
+        /**
+         * @brief Read index (just modified by the consumer).
+         */
+        alignas(MINBASECLI_CACHE_LINE_SIZE) std::atomic<size_t> tail;
+
+        /**
+         * @brief Ring data buffer.
+         */
+        alignas(MINBASECLI_CACHE_LINE_SIZE) uint8_t buffer[SIZE];
+};
+
+/*****************************************************************************/
+
+#endif /* MINBASECLI_SPSC_RING_H_ */
@@ -47,6 +47,7 @@
 #include <freertos/task.h>
 #include <esp_err.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include <driver/uart.h>
 #include <esp_vfs_dev.h>
 
@@ -86,9 +87,7 @@ void th_read_stdin(void* arg);
 MINBASECLI_ESPIDF::MINBASECLI_ESPIDF()
 {
     this->iface = NULL;
-    this->th_rx_read_head = 0;
-    this->th_rx_read_tail = 0;
-    this->th_rx_read[0] = '\0';
+    this->th_rx_waiter.store(NULL);
 }
 
 /*****************************************************************************/
@@ -113,39 +112,62 @@ bool MINBASECLI_ESPIDF::hal_setup(void* iface, const uint32_t baud_rate)
 
 /**
  * @details
- * This function return the number of bytes received by the interface that are
- * available to be read.
+ * This function blocks the calling task on a FreeRTOS task notification that
+ * the STDIN read task gives when new data is pushed into the read ring
+ * buffer, until there is data available to be read or the timeout expires.
  */
-size_t MINBASECLI_ESPIDF::hal_iface_available()
+bool MINBASECLI_ESPIDF::hal_iface_wait(const uint32_t timeout_ms)
 {
-    return (this->th_rx_read_head - this->th_rx_read_tail);
+    // Don't wait if there is data available to be read
+    if (this->th_rx_ring.available() > 0)
+    {   return true;   }
+
+    // Clear old notifications and register this task to be notified
+    ulTaskNotifyTake(pdTRUE, 0);
+    this->th_rx_waiter.store((void*)(xTaskGetCurrentTaskHandle()));
+
+    // Wait for data (check again in case it was pushed before registering)
+    if (this->th_rx_ring.available() == 0)
+    {   ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms));   }
+    this->th_rx_waiter.store(NULL);
+
+    return (this->th_rx_ring.available() > 0);
+}
+
+/**
+ * @details
+ * This function returns the ESP high resolution timer time (microseconds
+ * since boot).
+ */
+uint32_t MINBASECLI_ESPIDF::hal_time_us()
+{
+    return (uint32_t)(esp_timer_get_time());
 }
 
 /**
  * @details
- * This function returns a received byte from the interface. It checks if
- * there is any byte available to be read and increase the read circular
- * buffer tail index to "pop" this element from the buffer and return it.
+ * This function send a block of bytes through the interface. The STDOUT
+ * stream is bound to the UART driver, so the block is written to it with a
+ * single call (keeping the VFS line endings conversion) and flushed.
  */
-uint8_t MINBASECLI_ESPIDF::hal_iface_read()
+void MINBASECLI_ESPIDF::hal_iface_write(const uint8_t* data,
+        const size_t data_len)
 {
-    // Ignore if there is no available bytes to be read
-    if (hal_iface_available() == 0)
-    {   return 0;   }
-
-    // Return read bytes
-    this->th_rx_read_tail = (this->th_rx_read_tail + 1) %
-            MINBASECLI_MAX_READ_SIZE;
-    return th_rx_read[this->th_rx_read_tail];
+    fwrite(data, 1U, data_len, stdout);
+    fflush(stdout);
 }
 
 /**
  * @details
- * This function send a byte through the interface.
+ * This function writes the whole block of bytes through stdout (the UART
+ * VFS driver has no non-blocking write, so it is the same than the blocking
+ * write).
  */
-void MINBASECLI_ESPIDF::hal_iface_print(const uint8_t data_byte)
+size_t MINBASECLI_ESPIDF::hal_iface_try_write(const uint8_t* data,
+        const size_t data_len)
 {
-    printf("%c", (char)(data_byte));
+    hal_iface_write(data, data_len);
+    return data_len;
 }
 
 /*****************************************************************************/
@@ -241,12 +263,14 @@ bool MINBASECLI_ESPIDF::uart_setup(const uint32_t baud_rate)
 /**
  * @details
  * This function is the FreeRTOS Task that manages the STDIN data read.
- * It gets each new byte received from the interface and store them in the
- * read buffer (increasing the circular buffer head index).
+ * It gets each new byte received from the interface and push it into the
+ * read ring buffer (the byte is dropped if the ring is full), and notifies
+ * it to any task that is waiting for data.
  */
 void th_read_stdin(void* arg)
 {
     MINBASECLI_ESPIDF* _this = (MINBASECLI_ESPIDF*) arg;
+    TaskHandle_t waiter = NULL;
     int ch = EOF;
 
     while (true)
@@ -254,9 +278,10 @@ void th_read_stdin(void* arg)
         ch = getc(stdin);
         if (ch != EOF)
         {
-            _this->th_rx_read_head = \
-                    (_this->th_rx_read_head + 1) % MINBASECLI_MAX_READ_SIZE;
-            _this->th_rx_read[_this->th_rx_read_head] = ch;
+            _this->th_rx_ring.push((uint8_t)(ch));
+            waiter = (TaskHandle_t)(_this->th_rx_waiter.load());
+            if (waiter != NULL)
+            {   xTaskNotifyGive(waiter);   }
         }
         else
         {   vTaskDelay(10 / portTICK_PERIOD_MS);   }
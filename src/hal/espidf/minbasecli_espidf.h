@@ -46,13 +46,21 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <atomic>
+
+// Read Thread Reception Ring Buffer
+#include "../common/minbasecli_spsc_ring.h"
 
 /*****************************************************************************/
 
 /* Constants & Defines */
 
-// Maximum number of bytes that can be stored in thread data read buffer
-#define MINBASECLI_MAX_READ_SIZE 64
+// Number of bytes that can be stored in thread data read ring buffer
+// (it must be a power of two)
+#if !defined(MINBASECLI_RX_RING_SIZE)
+    #define MINBASECLI_RX_RING_SIZE 256
+#endif
 
 /*****************************************************************************/
 
@@ -70,19 +78,15 @@ class MINBASECLI_ESPIDF
     public:
 
         /**
-         * @brief Read buffer to store data from STDIN read thread.
-         */
-        char th_rx_read[MINBASECLI_MAX_READ_SIZE];
-
-        /**
-         * @brief th_rx_read head index for circular buffer behaviour.
+         * @brief Ring buffer to store data from STDIN read thread.
          */
-        uint32_t th_rx_read_head;
+        MINBASECLI_SPSC_RING<MINBASECLI_RX_RING_SIZE> th_rx_ring;
 
         /**
-         * @brief th_rx_read tail index for circular buffer behaviour.
+         * @brief Handle (TaskHandle_t) of the task that is waiting for new
+         * data, to be notified by STDIN read task (NULL if no task waits).
          */
-        uint32_t th_rx_read_tail;
+        std::atomic<void*> th_rx_waiter;
 
     /*************************************************************************/
 
@@ -116,19 +120,77 @@ class MINBASECLI_ESPIDF
          * are available in the current interface buffer to be read.
          * @return size_t The number of bytes available to be read.
          */
-        size_t hal_iface_available();
+        size_t hal_iface_available()
+        {   return this->th_rx_ring.available();   }
 
         /**
          * @brief Get/read a byte from the interface.
          * @return uint8_t The byte read.
          */
-        uint8_t hal_iface_read();
+        uint8_t hal_iface_read()
+        {
+            uint8_t data_byte = 0;
+
+            this->th_rx_ring.pop(&data_byte);
+            return data_byte;
+        }
+
+        /**
+         * @brief Get/read all the available bytes from the interface (up to
+         * a maximum number of bytes).
+         * @param data Pointer to the buffer to store the read bytes.
+         * @param data_max Maximum number of bytes to read.
+         * @return size_t The number of bytes read.
+         */
+        size_t hal_iface_read_bulk(uint8_t* data, const size_t data_max)
+        {   return this->th_rx_ring.pop(data, data_max);   }
+
+        /**
+         * @brief Get the number of received bytes that have been discarded
+         * because the interface reception buffer was full.
+         * @return uint32_t The number of dropped bytes.
+         */
+        uint32_t hal_iface_rx_dropped()
+        {   return this->th_rx_ring.dropped();   }
+
+        /**
+         * @brief Wait until the interface has received data to be read, or
+         * until a timeout expires.
+         * @param timeout_ms Maximum time to wait (milliseconds).
+         * @return true if there is received data available to be read.
+         * @return false if the timeout has expired without received data.
+         */
+        bool hal_iface_wait(const uint32_t timeout_ms);
+
+        /**
+         * @brief Get a free-running monotonic time (microseconds) to measure
+         * elapsed times (it wraps around every ~71 minutes).
+         * @return uint32_t The current time (microseconds).
+         */
+        uint32_t hal_time_us();
 
         /**
          * @brief Write a byte to the interface.
          * @param data_byte The byte to be written.
          */
-        void hal_iface_print(const uint8_t data_byte);
+        void hal_iface_print(const uint8_t data_byte)
+        {   printf("%c", (char)(data_byte));   }
+
+        /**
+         * @brief Write a block of bytes to the interface.
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         */
+        void hal_iface_write(const uint8_t* data, const size_t data_len);
+
+        /**
+         * @brief Write a block of bytes to the interface without blocking
+         * (just the part of it that the interface can accept now).
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         * @return size_t The number of bytes written.
+         */
+        size_t hal_iface_try_write(const uint8_t* data, const size_t data_len);
 
     /*************************************************************************/
 
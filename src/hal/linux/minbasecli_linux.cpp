@@ -33,7 +33,7 @@
 
 /* Include Guard */
 
-#if defined(__linux__)
+#if defined(__linux__) && !defined(MINBASECLI_HAL_LINUX_POLL)
 
 /*****************************************************************************/
 
@@ -42,28 +42,43 @@
 // Header Interface
 #include "minbasecli_linux.h"
 
+// Tracing Hooks
+#include "../../minbasecli_trace.h"
+
 // Device/Framework Libraries
+#include <poll.h>
 #include <pthread.h>
 #include <sys/select.h> // async stdin-stdout interface
 
 // Standard Libraries
+#include <atomic>
+#include <errno.h>
+#include <limits.h>     // PIPE_BUF
 #include <string.h>
-#include <stdio.h>      // getchar(), printf()
+#include <stdio.h>      // printf()
+#include <time.h>       // clock_gettime()
 #include <unistd.h>     // async stdin-stdout interface
 
 /*****************************************************************************/
 
-/* Read STDIN Stream Thread Prototype */
+/* In-Scope Static Private */
+
+// STDIN stream is read by a CLI (it can't be shared between read threads)
+static std::atomic<bool> stdin_in_use(false);
+
+/*****************************************************************************/
+
+/* Read Interface Thread Prototype */
 
 /**
- * @brief Posix Thread handler function to read STDIN data from the interface.
+ * @brief Posix Thread handler function to read data from the interface.
  * @param arg Posix Thread arguments.
  */
-void* th_read_stdin(void* arg);
+void* th_read_iface(void* arg);
 
 /*****************************************************************************/
 
-/* Constructor */
+/* Constructor & Destructor */
 
 /**
  * @details
@@ -71,10 +86,69 @@ void* th_read_stdin(void* arg);
  */
 MINBASECLI_LINUX::MINBASECLI_LINUX()
 {
+    pthread_condattr_t cond_attr;
+
     this->iface = NULL;
-    this->th_rx_read_head = 0;
-    this->th_rx_read_tail = 0;
-    this->th_rx_read[0] = '\0';
+    this->th_rx_fd = -1;
+    this->th_rx_stop = false;
+    this->th_rx_stop_pipe[0] = -1;
+    this->th_rx_stop_pipe[1] = -1;
+    this->th_rx_launched = false;
+    this->tx_fd = STDOUT_FILENO;
+
+    // Condition variable timeouts are measured with the monotonic clock
+    pthread_mutex_init(&(this->th_rx_mutex), NULL);
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&(this->th_rx_cond), &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
+    pthread_cond_init(&(this->th_rx_space_cond), NULL);
+}
+
+/**
+ * @details
+ * This destructor stops the interface read thread (it is woken up through
+ * the stop pipe if it is waiting for data, and through the space condition
+ * variable if it is waiting for free space in the read ring buffer), waits
+ * for it to end, and then releases the STDIN stream and the thread
+ * synchronization elements.
+ */
+MINBASECLI_LINUX::~MINBASECLI_LINUX()
+{
+    const uint8_t stop = 0U;
+
+    if (this->th_rx_launched)
+    {
+        pthread_mutex_lock(&(this->th_rx_mutex));
+        this->th_rx_stop = true;
+        pthread_cond_signal(&(this->th_rx_space_cond));
+        pthread_mutex_unlock(&(this->th_rx_mutex));
+        while ( (write(this->th_rx_stop_pipe[1], &stop, 1U) < 0) &&
+                (errno == EINTR) )
+        {}
+        pthread_join(this->th_rx_id, NULL);
+        close(this->th_rx_stop_pipe[0]);
+        close(this->th_rx_stop_pipe[1]);
+    }
+    if (this->th_rx_fd == STDIN_FILENO)
+    {   stdin_in_use.store(false);   }
+
+    pthread_cond_destroy(&(this->th_rx_space_cond));
+    pthread_cond_destroy(&(this->th_rx_cond));
+    pthread_mutex_destroy(&(this->th_rx_mutex));
+}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details
+ * This function returns the interface read file descriptor.
+ */
+int MINBASECLI_LINUX::get_iface_fd()
+{
+    return this->th_rx_fd;
 }
 
 /*****************************************************************************/
@@ -84,49 +158,165 @@ MINBASECLI_LINUX::MINBASECLI_LINUX()
 /**
  * @details
  * This function should get and initialize the interface element that is going
- * to be used by the CLI and it also start the STDIN data read thread.
+ * to be used by the CLI (the provided file descriptor or STDIN/STDOUT) and it
+ * also start the interface data read thread. The interface can't be changed
+ * once the read thread is running, and the STDIN stream can't be used if
+ * other CLI is already reading it.
  */
 bool MINBASECLI_LINUX::hal_setup(void* iface, const uint32_t baud_rate)
 {
+    bool stdin_free = false;
+
+    if (this->th_rx_fd >= 0)
+    {   return (iface == this->iface);   }
+
+    if (iface == NULL)
+    {
+        if (!stdin_in_use.compare_exchange_strong(stdin_free, true))
+        {
+            printf("Fail to setup CLI: STDIN is used by other CLI\n");
+            return false;
+        }
+        this->th_rx_fd = STDIN_FILENO;
+        this->tx_fd = STDOUT_FILENO;
+    }
+    else
+    {
+        this->th_rx_fd = *((int*)(iface));
+        this->tx_fd = this->th_rx_fd;
+    }
     this->iface = iface;
-    return launch_stdin_read_thread();
+
+    if (launch_read_thread() == false)
+    {
+        if (this->th_rx_fd == STDIN_FILENO)
+        {   stdin_in_use.store(false);   }
+        this->th_rx_fd = -1;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @details
+ * This function blocks the calling thread on the condition variable that the
+ * interface read thread signals when new data is pushed into the read ring
+ * buffer, until there is data available to be read or the timeout expires.
+ */
+bool MINBASECLI_LINUX::hal_iface_wait(const uint32_t timeout_ms)
+{
+    struct timespec deadline;
+    int rc = 0;
+
+    // Don't wait if there is data available to be read
+    if (this->th_rx_ring.available() > 0)
+    {   return true;   }
+
+    // Get the wait deadline time
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec = deadline.tv_sec + (time_t)(timeout_ms / 1000U);
+    deadline.tv_nsec = deadline.tv_nsec + (long)((timeout_ms % 1000U) *
+            1000000UL);
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec = deadline.tv_sec + 1;
+        deadline.tv_nsec = deadline.tv_nsec - 1000000000L;
+    }
+
+    // Wait for data
+    pthread_mutex_lock(&(this->th_rx_mutex));
+    while ( (this->th_rx_ring.available() == 0) && (rc != ETIMEDOUT) )
+    {
+        rc = pthread_cond_timedwait(&(this->th_rx_cond), &(this->th_rx_mutex),
+                &deadline);
+    }
+    pthread_mutex_unlock(&(this->th_rx_mutex));
+
+    return (this->th_rx_ring.available() > 0);
 }
 
 /**
  * @details
- * This function return the number of bytes received by the interface that are
- * available to be read.
+ * This function returns the system monotonic clock time in microseconds.
  */
-size_t MINBASECLI_LINUX::hal_iface_available()
+uint32_t MINBASECLI_LINUX::hal_time_us()
 {
-    return (this->th_rx_read_head - this->th_rx_read_tail);
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)( ((uint64_t)(now.tv_sec) * 1000000ULL) +
+            ((uint64_t)(now.tv_nsec) / 1000ULL) );
 }
 
 /**
  * @details
- * This function returns a received byte from the interface. It checks if
- * there is any byte available to be read and increase the read circular
- * buffer tail index to "pop" this element from the buffer and return it.
+ * This function send a block of bytes through the interface. For STDOUT it
+ * writes the whole block to the stream with a single call and flush it, so
+ * the data is shown without waiting for the stream buffer to be filled.
+ * Other file descriptors are written until the whole block has been sent,
+ * waiting for them to be writable if they are non-blocking and full.
  */
-uint8_t MINBASECLI_LINUX::hal_iface_read()
+void MINBASECLI_LINUX::hal_iface_write(const uint8_t* data,
+        const size_t data_len)
 {
-    // Ignore if there is no available bytes to be read
-    if (hal_iface_available() == 0)
-    {   return 0;   }
+    struct pollfd tx_pollfd;
+    size_t written = 0U;
+    ssize_t rc = 0;
+
+    if (this->tx_fd == STDOUT_FILENO)
+    {
+        fwrite(data, 1U, data_len, stdout);
+        fflush(stdout);
+        return;
+    }
 
-    // Return read bytes
-    this->th_rx_read_tail = (this->th_rx_read_tail + 1) %
-            MINBASECLI_MAX_READ_SIZE;
-    return th_rx_read[this->th_rx_read_tail];
+    tx_pollfd.fd = this->tx_fd;
+    tx_pollfd.events = POLLOUT;
+    while (written < data_len)
+    {
+        rc = write(this->tx_fd, &(data[written]), data_len - written);
+        if (rc > 0)
+        {   written = written + (size_t)(rc);   }
+        else if ( (rc < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)) )
+        {   poll(&tx_pollfd, 1, -1);   }
+        else if ( (rc < 0) && (errno == EINTR) )
+        {   continue;   }
+        else
+        {   return;   }
+    }
 }
 
 /**
  * @details
- * This function send a byte through the interface.
+ * This function checks with a zero timeout poll() if the interface can be
+ * written, and then writes up to PIPE_BUF bytes of the block (the space that
+ * a writable pipe ensures). Any stdio buffered output is sent first to keep
+ * the STDOUT output order.
  */
-void MINBASECLI_LINUX::hal_iface_print(const uint8_t data_byte)
+size_t MINBASECLI_LINUX::hal_iface_try_write(const uint8_t* data,
+        const size_t data_len)
 {
-    printf("%c", (char)(data_byte));
+    struct pollfd tx_pollfd;
+    size_t write_len = data_len;
+    ssize_t rc = 0;
+
+    if (this->tx_fd == STDOUT_FILENO)
+    {   fflush(stdout);   }
+
+    tx_pollfd.fd = this->tx_fd;
+    tx_pollfd.events = POLLOUT;
+    tx_pollfd.revents = 0;
+    if ( (poll(&tx_pollfd, 1, 0) <= 0) || !(tx_pollfd.revents & POLLOUT) )
+    {   return 0;   }
+
+    if (write_len > PIPE_BUF)
+    {   write_len = PIPE_BUF;   }
+    rc = write(this->tx_fd, data, write_len);
+    if (rc < 0)
+    {   return 0;   }
+
+    return (size_t)(rc);
 }
 
 /*****************************************************************************/
@@ -135,47 +325,149 @@ void MINBASECLI_LINUX::hal_iface_print(const uint8_t data_byte)
 
 /**
  * @details
- * This function create a Posix Thread to handle the STDIN data read from the
- * interface.
+ * This function creates the pipe that is used to wake up the read thread to
+ * stop it, and a Posix Thread to handle the data read from the interface
+ * (it is joined on the CLI object destruction).
  */
-bool MINBASECLI_LINUX::launch_stdin_read_thread()
+bool MINBASECLI_LINUX::launch_read_thread()
 {
-    pthread_t th_id;
     int rc = 0;
 
-    rc = pthread_create(&th_id, NULL, th_read_stdin, (void*)(this));
+    if (pipe(this->th_rx_stop_pipe) != 0)
+    {
+        printf("Fail to create interface read thread stop pipe: %s\n",
+                strerror(errno));
+        return false;
+    }
+
+    rc = pthread_create(&(this->th_rx_id), NULL, th_read_iface,
+            (void*)(this));
     if (rc != 0)
     {
-        printf("Fail to create STDIN read thread: %s\n", strerror(rc));
+        printf("Fail to create interface read thread: %s\n", strerror(rc));
+        close(this->th_rx_stop_pipe[0]);
+        close(this->th_rx_stop_pipe[1]);
         return false;
     }
+    this->th_rx_launched = true;
 
     return true;
 }
 
+/**
+ * @details
+ * This function signals the condition variable that the read thread waits
+ * on when the read ring buffer is full.
+ */
+void MINBASECLI_LINUX::th_rx_space_signal()
+{
+    pthread_mutex_lock(&(this->th_rx_mutex));
+    pthread_cond_signal(&(this->th_rx_space_cond));
+    pthread_mutex_unlock(&(this->th_rx_mutex));
+}
+
 /*****************************************************************************/
 
-/* STDIN Read Thread */
+/* Read Interface Thread */
 
 /**
  * @details
- * This function is the Posix Thread that manages the STDIN data read. It gets
- * each new byte received from the interface and store them in the read buffer
- * (increasing the circular buffer head index).
+ * This function pushes a chunk of received data into the read ring buffer of
+ * a CLI, signaling each pushed part to any thread that is waiting for data,
+ * and waiting for the CLI to free space in the ring while the chunk doesn't
+ * fit. It returns false if the read thread is requested to stop meanwhile.
  */
-void* th_read_stdin(void* arg)
+static bool th_rx_push(MINBASECLI_LINUX* _this, const uint8_t* data,
+        const size_t data_len)
 {
-    MINBASECLI_LINUX* _this = (MINBASECLI_LINUX*) arg;
-    uint8_t new_head = 0;
+    size_t pushed = 0U;
+    size_t push_len = 0U;
+    bool stop = false;
+
+    while (pushed < data_len)
+    {
+        // Push the part of the chunk that fits in the ring
+        push_len = _this->th_rx_ring.push_fit(&(data[pushed]),
+                data_len - pushed);
+        pushed = pushed + push_len;
+        if (push_len > 0U)
+        {   MINBASECLI_TRACE_RX_POINT(_this, push_len);   }
+        pthread_mutex_lock(&(_this->th_rx_mutex));
+        pthread_cond_signal(&(_this->th_rx_cond));
+
+        // Wait for free space in the ring to push the rest
+        if (pushed < data_len)
+        {
+            while ( (_this->th_rx_ring.space_wait_begin() == 0U) &&
+                    (_this->th_rx_stop == false) )
+            {
+                pthread_cond_wait(&(_this->th_rx_space_cond),
+                        &(_this->th_rx_mutex));
+            }
+            _this->th_rx_ring.space_wait_end();
+        }
+        stop = _this->th_rx_stop;
+        pthread_mutex_unlock(&(_this->th_rx_mutex));
+        if (stop)
+        {   return false;   }
+    }
+
+    return true;
+}
 
+/**
+ * @details
+ * This function is the Posix Thread that manages the interface data read. It
+ * waits with poll() for the interface file descriptor to be readable (or for
+ * the stop pipe, written on the CLI object destruction), gets each chunk of
+ * data received and push it into the read ring buffer of its CLI, and
+ * signals it to any thread that is waiting for data. If the chunk doesn't
+ * fit in the ring, it waits for the CLI to get data from the ring (the file
+ * descriptor is not read meanwhile, so no received data is dropped). The
+ * thread ends when it is requested to stop or when the end of the input is
+ * reached (i.e. STDIN stream end or a closed socket).
+ */
+void* th_read_iface(void* arg)
+{
+    MINBASECLI_LINUX* _this = (MINBASECLI_LINUX*) arg;
+    uint8_t rx_chunk[MINBASECLI_RX_RING_SIZE];
+    ssize_t rx_chunk_len = 0;
+    struct pollfd rx_pollfd[2];
+
+    rx_pollfd[0].fd = _this->th_rx_fd;
+    rx_pollfd[0].events = POLLIN;
+    rx_pollfd[1].fd = _this->th_rx_stop_pipe[0];
+    rx_pollfd[1].events = POLLIN;
     while (true)
     {
-        new_head = (_this->th_rx_read_head + 1) % MINBASECLI_MAX_READ_SIZE;
-        _this->th_rx_read[new_head] = getc(stdin);
-        _this->th_rx_read_head = new_head;
+        // Wait for received data or for the stop request
+        rx_pollfd[0].revents = 0;
+        rx_pollfd[1].revents = 0;
+        if (poll(rx_pollfd, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+            {   continue;   }
+            break;
+        }
+        if (rx_pollfd[1].revents != 0)
+        {   break;   }
+
+        rx_chunk_len = read(_this->th_rx_fd, rx_chunk, sizeof(rx_chunk));
+        if (rx_chunk_len > 0)
+        {
+            if (th_rx_push(_this, rx_chunk, (size_t)(rx_chunk_len)) == false)
+            {   break;   }
+        }
+        else if ( (rx_chunk_len < 0) && ((errno == EAGAIN) ||
+                  (errno == EWOULDBLOCK) || (errno == EINTR)) )
+        {   continue;   }
+        else
+        {   break;   }
     }
+
+    return NULL;
 }
 
 /*****************************************************************************/
 
-#endif /* __linux__ */
+#endif /* defined(__linux__) && !defined(MINBASECLI_HAL_LINUX_POLL) */
@@ -0,0 +1,249 @@
+
+/**
+ * @file    minbasecli_linux_poll.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A simple Command Line Interface C++ library implementation with HAL
+ * emphasis to be used in different kind of devices and frameworks.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#if defined(__linux__) && defined(MINBASECLI_HAL_LINUX_POLL)
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "minbasecli_linux_poll.h"
+
+// Device/Framework Libraries
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+
+// Standard Libraries
+#include <errno.h>
+#include <limits.h>     // PIPE_BUF
+#include <string.h>
+#include <stdio.h>      // printf()
+#include <time.h>       // clock_gettime()
+#include <unistd.h>     // read(), write()
+
+/*****************************************************************************/
+
+/* Constructor & Destructor */
+
+/**
+ * @details
+ * This constructor initializes all attributes of the CLI class.
+ */
+MINBASECLI_LINUX_POLL::MINBASECLI_LINUX_POLL()
+{
+    this->iface = NULL;
+    this->rx_fd = -1;
+    this->tx_fd = STDOUT_FILENO;
+    this->rx_fd_flags = -1;
+    this->rx_closed = false;
+}
+
+/**
+ * @details
+ * This destructor restores the original file status flags of the interface
+ * read file descriptor (so the non-blocking mode is not left set for other
+ * users of the same open file, i.e. the shell of the STDIN terminal).
+ */
+MINBASECLI_LINUX_POLL::~MINBASECLI_LINUX_POLL()
+{
+    if ( (this->rx_fd >= 0) && (this->rx_fd_flags >= 0) )
+    {   fcntl(this->rx_fd, F_SETFL, this->rx_fd_flags);   }
+}
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details
+ * This function returns the interface read file descriptor.
+ */
+int MINBASECLI_LINUX_POLL::get_iface_fd()
+{
+    return this->rx_fd;
+}
+
+/**
+ * @details
+ * This function returns if a read of the interface has reached the end of
+ * the input (i.e. STDIN pipe or file end, or a closed socket).
+ */
+bool MINBASECLI_LINUX_POLL::is_iface_closed()
+{
+    return this->rx_closed;
+}
+
+/*****************************************************************************/
+
+/* Specific Device/Framework HAL Methods */
+
+/**
+ * @details
+ * This function should get and initialize the interface element that is going
+ * to be used by the CLI. It gets the file descriptors to use (the provided
+ * one or STDIN/STDOUT) and set the read one as non-blocking.
+ */
+bool MINBASECLI_LINUX_POLL::hal_setup(void* iface, const uint32_t baud_rate)
+{
+    this->iface = iface;
+    if (iface == NULL)
+    {
+        this->rx_fd = STDIN_FILENO;
+        this->tx_fd = STDOUT_FILENO;
+    }
+    else
+    {
+        this->rx_fd = *((int*)(iface));
+        this->tx_fd = this->rx_fd;
+    }
+
+    // Set the read file descriptor as non-blocking
+    this->rx_fd_flags = fcntl(this->rx_fd, F_GETFL);
+    if (this->rx_fd_flags < 0)
+    {
+        printf("Fail to get interface fd flags: %s\n", strerror(errno));
+        return false;
+    }
+    if (fcntl(this->rx_fd, F_SETFL, this->rx_fd_flags | O_NONBLOCK) < 0)
+    {
+        printf("Fail to set interface fd non-blocking: %s\n",
+                strerror(errno));
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @details
+ * This function waits for the interface read file descriptor to be ready to
+ * be read (or for the end of its input) with poll(), until the timeout
+ * expires.
+ */
+bool MINBASECLI_LINUX_POLL::hal_iface_wait(const uint32_t timeout_ms)
+{
+    struct pollfd rx_pollfd;
+    int rc = 0;
+
+    if (this->rx_closed)
+    {   return false;   }
+
+    rx_pollfd.fd = this->rx_fd;
+    rx_pollfd.events = POLLIN;
+    rx_pollfd.revents = 0;
+
+    do
+    {   rc = poll(&rx_pollfd, 1, (int)(timeout_ms));   }
+    while ( (rc < 0) && (errno == EINTR) );
+
+    return (rc > 0);
+}
+
+/**
+ * @details
+ * This function returns the system monotonic clock time in microseconds.
+ */
+uint32_t MINBASECLI_LINUX_POLL::hal_time_us()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)( ((uint64_t)(now.tv_sec) * 1000000ULL) +
+            ((uint64_t)(now.tv_nsec) / 1000ULL) );
+}
+
+/**
+ * @details
+ * This function send a block of bytes through the interface. It loops until
+ * the whole block has been written, waiting for the file descriptor to be
+ * writable if it is non-blocking and its buffer is full.
+ */
+void MINBASECLI_LINUX_POLL::hal_iface_write(const uint8_t* data,
+        const size_t data_len)
+{
+    struct pollfd tx_pollfd;
+    size_t written = 0U;
+    ssize_t rc = 0;
+
+    tx_pollfd.fd = this->tx_fd;
+    tx_pollfd.events = POLLOUT;
+
+    while (written < data_len)
+    {
+        rc = write(this->tx_fd, &(data[written]), data_len - written);
+        if (rc > 0)
+        {   written = written + (size_t)(rc);   }
+        else if ( (rc < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)) )
+        {   poll(&tx_pollfd, 1, -1);   }
+        else if ( (rc < 0) && (errno == EINTR) )
+        {   continue;   }
+        else
+        {   return;   }
+    }
+}
+
+/**
+ * @details
+ * This function checks with a zero timeout poll() if the output file
+ * descriptor can be written, and then writes up to PIPE_BUF bytes of the
+ * block (the space that a writable pipe ensures).
+ */
+size_t MINBASECLI_LINUX_POLL::hal_iface_try_write(const uint8_t* data,
+        const size_t data_len)
+{
+    struct pollfd tx_pollfd;
+    size_t write_len = data_len;
+    ssize_t rc = 0;
+
+    tx_pollfd.fd = this->tx_fd;
+    tx_pollfd.events = POLLOUT;
+    tx_pollfd.revents = 0;
+    if ( (poll(&tx_pollfd, 1, 0) <= 0) || !(tx_pollfd.revents & POLLOUT) )
+    {   return 0;   }
+
+    if (write_len > PIPE_BUF)
+    {   write_len = PIPE_BUF;   }
+    rc = write(this->tx_fd, data, write_len);
+    if (rc < 0)
+    {   return 0;   }
+
+    return (size_t)(rc);
+}
+
+/*****************************************************************************/
+
+#endif /* defined(__linux__) && defined(MINBASECLI_HAL_LINUX_POLL) */
@@ -0,0 +1,262 @@
+
+/**
+ * @file    minbasecli_linux_poll.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A simple Command Line Interface C++ library implementation with HAL
+ * emphasis to be used in different kind of devices and frameworks.
+ *
+ * Event-driven Linux HAL (selected by building with MINBASECLI_HAL_LINUX_POLL
+ * defined). It doesn't use any read thread, the interface file descriptor
+ * is set as non-blocking and it is read in chunks by the CLI thread, so it
+ * can be added to an existing poll()/epoll() event loop.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#if defined(__linux__) && defined(MINBASECLI_HAL_LINUX_POLL)
+
+#ifndef MINBASECLI_LINUX_POLL_H_
+#define MINBASECLI_LINUX_POLL_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Device/Framework Libraries
+#include <sys/ioctl.h>
+#include <unistd.h>     // read()
+
+// Standard C/C++ libraries
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <errno.h>
+
+// Tracing Hooks
+#include "../../minbasecli_trace.h"
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief MINBASECLI_LINUX_POLL Class.
+ */
+class MINBASECLI_LINUX_POLL
+{
+    /*************************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new minbasecli linux poll object.
+         */
+        MINBASECLI_LINUX_POLL();
+
+        /**
+         * @brief Destroy the minbasecli linux poll object, restoring the
+         * original file status flags of the interface file descriptor.
+         */
+        ~MINBASECLI_LINUX_POLL();
+
+        /**
+         * @brief Get the file descriptor that the CLI reads, to be watched
+         * for input readiness (POLLIN/EPOLLIN) by an event loop.
+         * @return int The interface read file descriptor (-1 if the
+         * interface has not been setup).
+         */
+        int get_iface_fd();
+
+        /**
+         * @brief Check if the end of the interface input has been reached
+         * (then the file descriptor should be removed from the event loop).
+         * @return true if the interface input has been closed.
+         * @return false if the interface input is open.
+         */
+        bool is_iface_closed();
+
+    /*************************************************************************/
+
+    /* Protected Methods */
+
+    protected:
+
+        /**
+         * @brief Configure the interface and communication speed of the CLI.
+         * @param iface Pointer to the file descriptor (int) to be used by
+         * the CLI for both input and output (if NULL, STDIN and STDOUT are
+         * used).
+         * @param baud_rate Communication speed for the CLI (unused).
+         * @return true Interface configuration success.
+         * @return false Interface configuration fail.
+         */
+        bool hal_setup(void* iface, const uint32_t baud_rate);
+
+        /**
+         * @brief Get the number of bytes that the interface has received and
+         * are available in the current interface buffer to be read.
+         * @return size_t The number of bytes available to be read.
+         */
+        size_t hal_iface_available()
+        {
+            int num_bytes = 0;
+
+            if (ioctl(this->rx_fd, FIONREAD, &num_bytes) < 0)
+            {   return 0;   }
+
+            return (size_t)(num_bytes);
+        }
+
+        /**
+         * @brief Get/read a byte from the interface.
+         * @return uint8_t The byte read.
+         */
+        uint8_t hal_iface_read()
+        {
+            uint8_t data_byte = 0;
+
+            hal_iface_read_bulk(&data_byte, 1U);
+            return data_byte;
+        }
+
+        /**
+         * @brief Get/read all the available bytes from the interface (up to
+         * a maximum number of bytes).
+         * @param data Pointer to the buffer to store the read bytes.
+         * @param data_max Maximum number of bytes to read.
+         * @return size_t The number of bytes read.
+         */
+        size_t hal_iface_read_bulk(uint8_t* data, const size_t data_max)
+        {
+            ssize_t data_len = 0;
+
+            if ( this->rx_closed || (data_max == 0U) )
+            {   return 0;   }
+
+            do
+            {   data_len = read(this->rx_fd, data, data_max);   }
+            while ( (data_len < 0) && (errno == EINTR) );
+
+            // Check for end of input
+            if (data_len == 0)
+            {   this->rx_closed = true;   }
+
+            // Nothing read (EAGAIN) or read error
+            if (data_len <= 0)
+            {   return 0;   }
+            MINBASECLI_TRACE_RX_POINT(this, data_len);
+
+            return (size_t)(data_len);
+        }
+
+        /**
+         * @brief Get the number of received bytes that have been discarded
+         * because the interface reception buffer was full.
+         * @return uint32_t The number of dropped bytes.
+         */
+        uint32_t hal_iface_rx_dropped()
+        {   return 0;   }
+
+        /**
+         * @brief Wait until the interface has received data to be read, or
+         * until a timeout expires.
+         * @param timeout_ms Maximum time to wait (milliseconds).
+         * @return true if there is received data available to be read.
+         * @return false if the timeout has expired without received data.
+         */
+        bool hal_iface_wait(const uint32_t timeout_ms);
+
+        /**
+         * @brief Get a free-running monotonic time (microseconds) to measure
+         * elapsed times (it wraps around every ~71 minutes).
+         * @return uint32_t The current time (microseconds).
+         */
+        uint32_t hal_time_us();
+
+        /**
+         * @brief Write a byte to the interface.
+         * @param data_byte The byte to be written.
+         */
+        void hal_iface_print(const uint8_t data_byte)
+        {   hal_iface_write(&data_byte, 1U);   }
+
+        /**
+         * @brief Write a block of bytes to the interface.
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         */
+        void hal_iface_write(const uint8_t* data, const size_t data_len);
+
+        /**
+         * @brief Write a block of bytes to the interface without blocking
+         * (just the part of it that the interface can accept now).
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         * @return size_t The number of bytes written.
+         */
+        size_t hal_iface_try_write(const uint8_t* data, const size_t data_len);
+
+    /*************************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Pointer to interface used.
+         */
+        void* iface;
+
+        /**
+         * @brief Interface read file descriptor.
+         */
+        int rx_fd;
+
+        /**
+         * @brief Interface write file descriptor.
+         */
+        int tx_fd;
+
+        /**
+         * @brief Original file status flags of the read file descriptor.
+         */
+        int rx_fd_flags;
+
+        /**
+         * @brief Store if the end of the interface input has been reached.
+         */
+        bool rx_closed;
+};
+
+/*****************************************************************************/
+
+#endif /* MINBASECLI_LINUX_POLL_H_ */
+
+#endif /* defined(__linux__) && defined(MINBASECLI_HAL_LINUX_POLL) */
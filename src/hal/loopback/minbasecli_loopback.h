@@ -0,0 +1,473 @@
+
+/**
+ * @file    minbasecli_loopback.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * In-memory loopback HAL (the MINBASECLI_NONE interface with memory buffers
+ * behind it) to run the CLI core without any device, terminal or thread, for
+ * tests and benchmarks. The input bytes are read from a buffer provided by
+ * the application (not copied), and the output bytes are captured into
+ * another one (or just counted if no buffer is provided).
+ *
+ * The HAL time is a virtual clock, so the results are deterministic. It is
+ * just advanced by the waits, by advance_time_us() and, if a baud rate is
+ * set, by the simulated serial line: each byte takes 10 bits times, the
+ * input bytes arrive one after another from the moment that they are set,
+ * and the writes wait for the previous output bytes to be sent.
+ *
+ * It can be used as the default CLI HAL (MINBASECLI_HAL_LOOPBACK defined),
+ * or through MINBASECLI_CORE<MINBASECLI_LOOPBACK> (see minbasecli_impl.h).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef MINBASECLI_LOOPBACK_H_
+#define MINBASECLI_LOOPBACK_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C/C++ libraries
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/*****************************************************************************/
+
+/* Constants & Defines */
+
+// Number of bits sent through the simulated serial line for each byte
+// (start bit, 8 data bits and stop bit)
+#define MINBASECLI_LOOPBACK_BITS_PER_BYTE 10U
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief MINBASECLI_LOOPBACK Class.
+ */
+class MINBASECLI_LOOPBACK
+{
+    /*************************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new minbasecli loopback object.
+         */
+        MINBASECLI_LOOPBACK()
+        {
+            this->iface = NULL;
+            this->in_data = NULL;
+            this->in_len = 0U;
+            this->in_pos = 0U;
+            this->in_start_us = 0U;
+            this->out_data = NULL;
+            this->out_size = 0U;
+            this->out_len = 0U;
+            this->out_total = 0U;
+            this->out_dropped = 0U;
+            this->baud_rate = 0U;
+            this->time_us = 0U;
+            this->tx_busy_until_us = 0U;
+        }
+
+        /**
+         * @brief Set the input bytes to be read by the CLI (the pending ones
+         * are discarded). The bytes are not copied, so they must be valid
+         * until they are read.
+         * @param data Pointer to the input bytes.
+         * @param data_len Number of input bytes.
+         */
+        void set_input(const char* data, const size_t data_len)
+        {
+            this->in_data = (const uint8_t*)(data);
+            this->in_len = (data == NULL) ? 0U : data_len;
+            this->in_pos = 0U;
+            this->in_start_us = this->time_us;
+        }
+
+        /**
+         * @brief Set a null terminated string as the input to be read by the
+         * CLI (see set_input(data, data_len)).
+         * @param str The input string.
+         */
+        void set_input(const char* str)
+        {   set_input(str, (str == NULL) ? 0U : strlen(str));   }
+
+        /**
+         * @brief Get the number of input bytes that have not been read yet.
+         * @return size_t The number of pending input bytes.
+         */
+        size_t get_input_pending()
+        {   return (this->in_len - this->in_pos);   }
+
+        /**
+         * @brief Set the buffer to capture the CLI output (NULL to just
+         * count the output bytes). The captured length is cleared.
+         * @param buffer Pointer to the output capture buffer.
+         * @param buffer_size Size of the output capture buffer.
+         */
+        void set_output(uint8_t* buffer, const size_t buffer_size)
+        {
+            this->out_data = buffer;
+            this->out_size = (buffer == NULL) ? 0U : buffer_size;
+            this->out_len = 0U;
+        }
+
+        /**
+         * @brief Get the number of output bytes captured into the output
+         * buffer.
+         * @return size_t The number of captured bytes.
+         */
+        size_t get_output_len()
+        {   return this->out_len;   }
+
+        /**
+         * @brief Clear the captured output (the next output bytes are
+         * captured from the start of the output buffer).
+         */
+        void clear_output()
+        {   this->out_len = 0U;   }
+
+        /**
+         * @brief Get the total number of bytes written by the CLI.
+         * @return uint64_t The number of output bytes.
+         */
+        uint64_t get_output_bytes()
+        {   return this->out_total;   }
+
+        /**
+         * @brief Get the number of output bytes that have not been captured
+         * because the output buffer was full.
+         * @return uint32_t The number of dropped output bytes.
+         */
+        uint32_t get_output_dropped_bytes()
+        {   return this->out_dropped;   }
+
+        /**
+         * @brief Set the simulated serial line speed.
+         * @param bauds Serial line speed (0 for no speed limit, the default).
+         */
+        void set_baud_rate(const uint32_t bauds)
+        {   this->baud_rate = bauds;   }
+
+        /**
+         * @brief Advance the virtual clock.
+         * @param elapsed_us Number of microseconds to advance.
+         */
+        void advance_time_us(const uint32_t elapsed_us)
+        {   this->time_us = this->time_us + elapsed_us;   }
+
+    /*************************************************************************/
+
+    /* Protected Methods */
+
+    protected:
+
+        /**
+         * @brief Configure the interface and communication speed of the CLI.
+         * @param iface Pointer to interface element that will be used by the
+         * CLI (not used).
+         * @param baud_rate Communication speed for the CLI (not used, see
+         * set_baud_rate()).
+         * @return true Interface configuration success.
+         * @return false Interface configuration fail.
+         */
+        bool hal_setup(void* iface, const uint32_t baud_rate)
+        {
+            (void)(baud_rate);
+            this->iface = iface;
+            return true;
+        }
+
+        /**
+         * @brief Get the number of bytes that the interface has received and
+         * are available in the current interface buffer to be read.
+         * @return size_t The number of bytes available to be read.
+         */
+        size_t hal_iface_available()
+        {   return (in_arrived(this->time_us) - this->in_pos);   }
+
+        /**
+         * @brief Get/read a byte from the interface.
+         * @return uint8_t The byte read.
+         */
+        uint8_t hal_iface_read()
+        {
+            uint8_t data_byte = 0;
+
+            hal_iface_read_bulk(&data_byte, 1U);
+            return data_byte;
+        }
+
+        /**
+         * @brief Get/read all the available bytes from the interface (up to
+         * a maximum number of bytes).
+         * @param data Pointer to the buffer to store the read bytes.
+         * @param data_max Maximum number of bytes to read.
+         * @return size_t The number of bytes read.
+         */
+        size_t hal_iface_read_bulk(uint8_t* data, const size_t data_max)
+        {
+            size_t data_len = hal_iface_available();
+
+            if (data_len > data_max)
+            {   data_len = data_max;   }
+            memcpy(data, &(this->in_data[this->in_pos]), data_len);
+            this->in_pos = this->in_pos + data_len;
+
+            return data_len;
+        }
+
+        /**
+         * @brief Get the number of received bytes that have been discarded
+         * because the interface reception buffer was full.
+         * @return uint32_t The number of dropped bytes.
+         */
+        uint32_t hal_iface_rx_dropped()
+        {   return 0;   }
+
+        /**
+         * @brief Wait until the interface has received data to be read, or
+         * until a timeout expires (the virtual clock is advanced to the
+         * next input byte arrival, or by the timeout).
+         * @param timeout_ms Maximum time to wait (milliseconds).
+         * @return true if there is received data available to be read.
+         * @return false if the timeout has expired without received data.
+         */
+        bool hal_iface_wait(const uint32_t timeout_ms)
+        {
+            uint64_t deadline_us = this->time_us +
+                    ((uint64_t)(timeout_ms) * 1000U);
+            uint64_t arrival_us = 0U;
+
+            if (hal_iface_available() > 0U)
+            {   return true;   }
+
+            // Advance the clock to the next input byte arrival
+            if (this->in_pos < this->in_len)
+            {
+                arrival_us = this->in_start_us +
+                        line_time_us(this->in_pos + 1U);
+                if (arrival_us <= deadline_us)
+                {
+                    this->time_us = arrival_us;
+                    return true;
+                }
+            }
+            this->time_us = deadline_us;
+
+            return false;
+        }
+
+        /**
+         * @brief Get a free-running monotonic time (microseconds) to measure
+         * elapsed times (it wraps around every ~71 minutes).
+         * @return uint32_t The current virtual time (microseconds).
+         */
+        uint32_t hal_time_us()
+        {   return (uint32_t)(this->time_us);   }
+
+        /**
+         * @brief Write a byte to the interface.
+         * @param data_byte The byte to be written.
+         */
+        void hal_iface_print(const uint8_t data_byte)
+        {   hal_iface_write(&data_byte, 1U);   }
+
+        /**
+         * @brief Write a block of bytes to the interface (the virtual clock
+         * is advanced until the block has been sent).
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         */
+        void hal_iface_write(const uint8_t* data, const size_t data_len)
+        {
+            out_store(data, data_len);
+            if (this->tx_busy_until_us > this->time_us)
+            {   this->time_us = this->tx_busy_until_us;   }
+        }
+
+        /**
+         * @brief Write a block of bytes to the interface without blocking
+         * (nothing is written if the simulated line is sending a previous
+         * block, then the virtual clock is advanced to its end, so a retry
+         * succeeds).
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         * @return size_t The number of bytes written.
+         */
+        size_t hal_iface_try_write(const uint8_t* data, const size_t data_len)
+        {
+            if (this->tx_busy_until_us > this->time_us)
+            {
+                this->time_us = this->tx_busy_until_us;
+                return 0;
+            }
+            out_store(data, data_len);
+
+            return data_len;
+        }
+
+    /*************************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief Pointer to interface used.
+         */
+        void* iface;
+
+        /**
+         * @brief Input bytes (owned by the application), their number and
+         * the number of them already read.
+         */
+        const uint8_t* in_data;
+        size_t in_len;
+        size_t in_pos;
+
+        /**
+         * @brief Virtual time when the input was set (microseconds).
+         */
+        uint64_t in_start_us;
+
+        /**
+         * @brief Output capture buffer (owned by the application), its size
+         * and the number of bytes captured.
+         */
+        uint8_t* out_data;
+        size_t out_size;
+        size_t out_len;
+
+        /**
+         * @brief Total number of output bytes, and number of them not
+         * captured because the output buffer was full.
+         */
+        uint64_t out_total;
+        uint32_t out_dropped;
+
+        /**
+         * @brief Simulated serial line speed (0 for no speed limit).
+         */
+        uint32_t baud_rate;
+
+        /**
+         * @brief Virtual clock (microseconds).
+         */
+        uint64_t time_us;
+
+        /**
+         * @brief Virtual time when the simulated line ends sending the
+         * output bytes (microseconds).
+         */
+        uint64_t tx_busy_until_us;
+
+    /*************************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Get the time that the simulated serial line takes to send
+         * a number of bytes.
+         * @param num_bytes Number of bytes.
+         * @return uint64_t The line time (microseconds, rounded up, or 0
+         * if there is no speed limit).
+         */
+        uint64_t line_time_us(const size_t num_bytes)
+        {
+            if (this->baud_rate == 0U)
+            {   return 0U;   }
+            return ((((uint64_t)(num_bytes) *
+                    MINBASECLI_LOOPBACK_BITS_PER_BYTE * 1000000U) +
+                    this->baud_rate - 1U) / this->baud_rate);
+        }
+
+        /**
+         * @brief Get the number of input bytes that have arrived at a time
+         * (all of them if there is no speed limit).
+         * @param now_us The time (microseconds).
+         * @return size_t The number of arrived input bytes.
+         */
+        size_t in_arrived(const uint64_t now_us)
+        {
+            uint64_t num_bytes = 0U;
+
+            if (this->baud_rate == 0U)
+            {   return this->in_len;   }
+            num_bytes = ((now_us - this->in_start_us) * this->baud_rate) /
+                    (MINBASECLI_LOOPBACK_BITS_PER_BYTE * 1000000U);
+            if (num_bytes > this->in_len)
+            {   num_bytes = this->in_len;   }
+
+            return (size_t)(num_bytes);
+        }
+
+        /**
+         * @brief Capture the output bytes (up to the free space of the
+         * output buffer) and schedule them on the simulated serial line.
+         * @param data Pointer to the output bytes.
+         * @param data_len Number of output bytes.
+         */
+        void out_store(const uint8_t* data, const size_t data_len)
+        {
+            size_t store_len = this->out_size - this->out_len;
+
+            if (store_len > data_len)
+            {   store_len = data_len;   }
+            if (store_len > 0U)
+            {
+                memcpy(&(this->out_data[this->out_len]), data, store_len);
+                this->out_len = this->out_len + store_len;
+            }
+            if (this->out_data != NULL)
+            {
+                this->out_dropped = this->out_dropped +
+                        (uint32_t)(data_len - store_len);
+            }
+            this->out_total = this->out_total + data_len;
+
+            // Simulated line busy time
+            if (this->tx_busy_until_us < this->time_us)
+            {   this->tx_busy_until_us = this->time_us;   }
+            this->tx_busy_until_us = this->tx_busy_until_us +
+                    line_time_us(data_len);
+        }
+};
+
+/*****************************************************************************/
+
+#endif /* MINBASECLI_LOOPBACK_H_ */
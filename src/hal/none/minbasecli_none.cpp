@@ -89,32 +89,44 @@ bool MINBASECLI_NONE::hal_setup(void* iface, const uint32_t baud_rate)
 
 /**
  * @details
- * This function return the number of bytes received by the interface that are
- * available to be read.
+ * This function waits until the interface has received data to be read, or
+ * until the timeout expires.
  */
-size_t MINBASECLI_NONE::hal_iface_available()
+bool MINBASECLI_NONE::hal_iface_wait(const uint32_t timeout_ms)
 {
-    return 0;
+    return false;
 }
 
 /**
  * @details
- * This function returns a received byte from the interface.
+ * This function should return a free-running time in microseconds.
  */
-uint8_t MINBASECLI_NONE::hal_iface_read()
+uint32_t MINBASECLI_NONE::hal_time_us()
 {
     return 0;
 }
 
 /**
  * @details
- * This function send a byte through the interface.
+ * This function send a block of bytes through the interface.
  */
-void MINBASECLI_NONE::hal_iface_print(const uint8_t data_byte)
+void MINBASECLI_NONE::hal_iface_write(const uint8_t* data,
+        const size_t data_len)
 {
     return;
 }
 
+/**
+ * @details
+ * This function should write the bytes that the interface can accept now
+ * without blocking, and return the number of them.
+ */
+size_t MINBASECLI_NONE::hal_iface_try_write(const uint8_t* data,
+        const size_t data_len)
+{
+    return data_len;
+}
+
 /*****************************************************************************/
 
 #endif /* !ARDUINO !ESP_PLATFORM !__linux__ !_WIN32 ... */
@@ -47,118 +47,74 @@
 // Header Interface
 #include "minbasecli_stm32.h"
 
+// Tracing Hooks
+#include "../../minbasecli_trace.h"
+
 // Standard Libraries
 #include <stdio.h>
 #include <string.h>
 
-// Device/Framework Libraries
-#if defined(STM32F0)
-    #include "stm32f0xx_hal.h"
-#elif defined(STM32F1)
-    #include "stm32f1xx_hal.h"
-#elif defined(STM32F2)
-    #include "stm32f2xx_hal.h"
-#elif defined(STM32F3)
-    #include "stm32f3xx_hal.h"
-#elif defined(STM32F4)
-    #include "stm32f4xx_hal.h"
-#elif defined(STM32F7)
-    #include "stm32f7xx_hal.h"
-#elif defined(STM32L0)
-    #include "stm32l0xx_hal.h"
-#elif defined(STM32L1)
-    #include "stm32l1xx_hal.h"
-#elif defined(STM32L4)
-    #include "stm32l4xx_hal.h"
-#elif defined(STM32L5)
-    #include "stm32l5xx_hal.h"
-#elif defined(STM32G0)
-    #include "stm32g0xx_hal.h"
-#elif defined(STM32G4)
-    #include "stm32g4xx_hal.h"
-#elif defined(STM32H7)
-    #include "stm32h7xx_hal.h"
-#elif defined(STM32U5)
-    #include "stm32u5xx_hal.h"
-#elif defined(STM32MP1)
-    #include "stm32mp1xx_hal.h"
-#elif defined(STM32WL)
-    #include "stm32wlxx_hal.h"
-#elif defined(STM32WB)
-    #include "stm32wbxx_hal.h"
-#else
-    #error "minbasecli_stm32 - Unsupported device/system."
-#endif
-
 /*****************************************************************************/
 
 /* Constants & Defines */
 
-// Interface Element Data Type
-#define _IFACE UART_HandleTypeDef
-
 // Default USART
 #define DEFAULT_UART USART2
 
 // Default Baudrate
 #define DEFAULT_BAUDS 19200
 
+static_assert( (MINBASECLI_STM32_RX_BUFFER_SIZE >= 2) &&
+        (MINBASECLI_STM32_RX_BUFFER_SIZE <= 32768) &&
+        ((MINBASECLI_STM32_RX_BUFFER_SIZE &
+         (MINBASECLI_STM32_RX_BUFFER_SIZE - 1)) == 0),
+        "minbasecli - STM32 RX buffer size must be a power of two.");
+
 /*****************************************************************************/
 
 /* In-Scope Static Private */
 
-// Specific UART element
-static UART_HandleTypeDef uart2;
-
-// IT callback received byte
-static uint8_t rx_byte[1];
-
-// Read index that point to read buffer data FIFO element
-static uint8_t rx_read_head = 0;
-static uint8_t rx_read_tail = 0;
-
-// Received bytes buffer
-static uint8_t rx_buffer[MINBASECLI_MAX_READ_SIZE];
+// CLIs of the UARTs whose interrupts are dispatched
+static MINBASECLI_STM32* uart_clis[MINBASECLI_STM32_MAX_UARTS];
 
 /*****************************************************************************/
 
-/* In-Scope Function Prototypes */
-
-/**
- * @brief  Rx Transfer completed callback
- * @param  UartHandle: UART handle
- * @note   UART Rx transfer completed callback (something was received).
- * @retval None
- */
-static void HAL_UART_RxCpltCallback(UART_HandleTypeDef* UartHandle);
-
-/**
- * @brief  Tx Transfer completed callback
- * @param  UartHandle: UART handle.
- * @note   UART Tx transfer completed callback (something was sent).
- * @retval None
- */
-static void HAL_UART_TxCpltCallback(UART_HandleTypeDef *UartHandle);
+/* Constructor */
 
 /**
- * @brief  UART error callbacks
- * @param  UartHandle: UART handle
- * @note   UART transfer operation error callback.
- * @retval None
+ * @details
+ * This constructor initializes all attributes of the CLI class.
  */
-static void HAL_UART_ErrorCallback(UART_HandleTypeDef* UartHandle);
+MINBASECLI_STM32::MINBASECLI_STM32()
+{
+    this->iface = NULL;
+    this->rx_head = 0U;
+    this->rx_tail = 0U;
+    this->rx_dropped = 0U;
+    this->rx_byte = 0U;
+}
 
 /*****************************************************************************/
 
-/* Constructor */
+/* Public Methods */
 
 /**
  * @details
- * This constructor initializes all attributes of the CLI class.
+ * This function looks for the CLI that uses the UART of the interrupt, and
+ * passes the reception to it.
  */
-MINBASECLI_STM32::MINBASECLI_STM32()
+bool MINBASECLI_STM32::uart_rx_callback(UART_HandleTypeDef* huart)
 {
-    this->iface = NULL;
+    for (uint8_t i = 0U; i < MINBASECLI_STM32_MAX_UARTS; i++)
+    {
+        if ( (uart_clis[i] != NULL) && (uart_clis[i]->iface == huart) )
+        {
+            uart_clis[i]->uart_rx_complete();
+            return true;
+        }
+    }
+
+    return false;
 }
 
 /*****************************************************************************/
@@ -168,70 +124,139 @@ MINBASECLI_STM32::MINBASECLI_STM32()
 /**
  * @details
  * This function should get and initialize the interface element that is going
- * to be used by the CLI.
+ * to be used by the CLI. The CLI is registered to get the interrupts of its
+ * UART (just one CLI can use each UART).
  */
 bool MINBASECLI_STM32::hal_setup(void* iface, const uint32_t baud_rate)
 {
+    uint8_t free_slot = MINBASECLI_STM32_MAX_UARTS;
+
     if (iface == NULL)
     {   return false;   }
 
+    // Get a free dispatch slot (and check that the UART is not used)
+    for (uint8_t i = 0U; i < MINBASECLI_STM32_MAX_UARTS; i++)
+    {
+        if (uart_clis[i] == NULL)
+        {
+            if (free_slot == MINBASECLI_STM32_MAX_UARTS)
+            {   free_slot = i;   }
+        }
+        else if (uart_clis[i]->iface == iface)
+        {   return (uart_clis[i] == this);   }
+    }
+    if (free_slot == MINBASECLI_STM32_MAX_UARTS)
+    {   return false;   }
+
     this->iface = iface;
+    uart_clis[free_slot] = this;
     if (!uart_setup(baud_rate, true))
-    {   return false;   }
+    {
+        uart_clis[free_slot] = NULL;
+        return false;
+    }
 
     return true;
 }
 
 /**
  * @details
- * This function return the number of bytes received by the interface that are
- * available to be read.
+ * This function polls the reception buffer until there is received data
+ * available to be read or the timeout expires (there is no wait mechanism
+ * available), measuring the time with the HAL millisecond tick.
  */
-size_t MINBASECLI_STM32::hal_iface_available()
+bool MINBASECLI_STM32::hal_iface_wait(const uint32_t timeout_ms)
 {
-    return (rx_read_head - rx_read_tail);
+    uint32_t t0 = HAL_GetTick();
+
+    while (this->rx_head == this->rx_tail)
+    {
+        if ((uint32_t)(HAL_GetTick() - t0) >= timeout_ms)
+        {   return false;   }
+    }
+
+    return true;
 }
 
 /**
  * @details
- * This function returns a received byte from the interface. It checks if
- * there is any byte available to be read and increase the read circular
- * buffer tail index to "pop" this element from the buffer and return it.
+ * This function returns the HAL millisecond tick time plus the elapsed part
+ * of the current tick, got from the SysTick down-counter (it counts core
+ * clock cycles), so the time has microseconds resolution. The counter is
+ * read again if the tick has changed while reading it.
  */
-uint8_t MINBASECLI_STM32::hal_iface_read()
+uint32_t MINBASECLI_STM32::hal_time_us()
 {
-    // Ignore if there is no available bytes to be read
-    if (hal_iface_available() == 0)
-    {   return 0;   }
+    uint32_t cycles_per_us = (SysTick->LOAD + 1U) / 1000U;
+    uint32_t tick_ms = 0U;
+    uint32_t count = 0U;
+
+    do
+    {
+        tick_ms = HAL_GetTick();
+        count = SysTick->VAL;
+    } while (tick_ms != HAL_GetTick());
+
+    if (cycles_per_us == 0U)
+    {   return (tick_ms * 1000U);   }
 
-    // Return read bytes
-    rx_read_tail = (rx_read_tail + 1) % MINBASECLI_MAX_READ_SIZE;
-    return rx_buffer[rx_read_tail];
+    return (tick_ms * 1000U) + ((SysTick->LOAD - count) / cycles_per_us);
 }
 
 /**
  * @details
- * This function send a byte through the interface.
+ * This function send a block of bytes through the interface.
  */
-void MINBASECLI_STM32::hal_iface_print(const uint8_t data_byte)
+void MINBASECLI_STM32::hal_iface_write(const uint8_t* data,
+        const size_t data_len)
 {
     // Cast to specific interface type
     _IFACE* _Serial = (_IFACE*) this->iface;
 
-    // Check if peripheral is ready to send data
+    // Wait for any ongoing transmission to end
     HAL_UART_StateTypeDef state = HAL_UART_GetState(_Serial);
-    while ((state & HAL_UART_STATE_BUSY_TX) == HAL_UART_STATE_BUSY_TX);
-    // No-Blocking instead above while:
-    //if ((state & HAL_UART_STATE_BUSY_TX) == HAL_UART_STATE_BUSY_TX)
-    //{   return;   }
+    while ((state & HAL_UART_STATE_BUSY_TX) == HAL_UART_STATE_BUSY_TX)
+    {   state = HAL_UART_GetState(_Serial);   }
 
-    // Transmit
-    if (HAL_UART_Transmit_IT(_Serial, &data_byte, 1) != HAL_OK)
+    // Blocking transmit of the whole block (the data buffer is owned by the
+    // caller and it could be reused as soon as this function returns)
+    if (HAL_UART_Transmit(_Serial, (uint8_t*)(data), (uint16_t)(data_len),
+            HAL_MAX_DELAY) != HAL_OK)
     {   return;   }
 
     return;
 }
 
+/**
+ * @details
+ * This function returns without writing if the UART is busy sending a
+ * previous block, otherwise it copies the block (up to the transmission
+ * buffer size) into the CLI transmission buffer, that is owned by the UART
+ * while it is sent, and starts its interrupt driven transmission.
+ */
+size_t MINBASECLI_STM32::hal_iface_try_write(const uint8_t* data,
+        const size_t data_len)
+{
+    // Cast to specific interface type
+    _IFACE* _Serial = (_IFACE*) this->iface;
+    size_t write_len = data_len;
+
+    // Check if peripheral is ready to send data
+    HAL_UART_StateTypeDef state = HAL_UART_GetState(_Serial);
+    if ((state & HAL_UART_STATE_BUSY_TX) == HAL_UART_STATE_BUSY_TX)
+    {   return 0;   }
+
+    // Copy the bytes and start the transmission
+    if (write_len > MINBASECLI_STM32_TX_BUFFER_SIZE)
+    {   write_len = MINBASECLI_STM32_TX_BUFFER_SIZE;   }
+    memcpy(this->tx_buffer, data, write_len);
+    if (HAL_UART_Transmit_IT(_Serial, this->tx_buffer,
+            (uint16_t)(write_len)) != HAL_OK)
+    {   return 0;   }
+
+    return write_len;
+}
+
 /*****************************************************************************/
 
 /* Private Methods */
@@ -253,7 +278,8 @@ bool MINBASECLI_STM32::uart_setup(const uint32_t baud_rate,
     if (self_initialization)
     {
         // Setup UART Properties
-        _Serial->Instance = DEFAULT_UART;
+        if (_Serial->Instance == NULL)
+        {   _Serial->Instance = DEFAULT_UART;   }
         _Serial->Init.BaudRate = baud_rate;
         _Serial->Init.WordLength = UART_WORDLENGTH_8B;
         _Serial->Init.StopBits = UART_STOPBITS_1;
@@ -278,48 +304,58 @@ bool MINBASECLI_STM32::uart_setup(const uint32_t baud_rate,
         {   return false;   }
     }
 
-    // Start Async Reception for 1 bytes chunks and store it in `rx_buffer`
+    // Start Async Reception for 1 bytes chunks and store it in `rx_byte`
     // The reception callback will fire for each byte reception
-    if(HAL_UART_Receive_IT(_Serial, (uint8_t*)rx_byte, 1) != HAL_OK)
+    if(HAL_UART_Receive_IT(_Serial, &(this->rx_byte), 1) != HAL_OK)
     {   return false;   }
 
     return true;
 }
 
-/*****************************************************************************/
-
-/* HAL UART Operation Callbacks */
-
 /**
  * @details
- * This function fires on each UART Rx reception. It get the last received
- * byte and store it into the circular buffer, and set again the interrupt for
- * next detections.
+ * This function is called from the UART reception interrupt. It stores the
+ * last received byte into the reception ring buffer (or counts it as dropped
+ * if the buffer is full), and restart the interrupt driven reception for the
+ * next byte.
  */
-static void HAL_UART_RxCpltCallback(UART_HandleTypeDef* UartHandle)
+void MINBASECLI_STM32::uart_rx_complete()
 {
-    // Increase number of received bytes
-    rx_read_head = (rx_read_head + 1) % MINBASECLI_MAX_READ_SIZE;
-    rx_buffer[rx_read_head] = rx_byte[0];
+    uint16_t head = this->rx_head;
+
+    if ((uint16_t)(head - this->rx_tail) < MINBASECLI_STM32_RX_BUFFER_SIZE)
+    {
+        this->rx_buffer[head & (MINBASECLI_STM32_RX_BUFFER_SIZE - 1U)] =
+                this->rx_byte;
+        this->rx_head = head + 1U;
+        MINBASECLI_TRACE_RX_POINT(this, 1U);
+    }
+    else
+    {   this->rx_dropped = this->rx_dropped + 1U;   }
 
     // Reload Async Reception
-    if(HAL_UART_Receive_IT(_Serial, (uint8_t*)rx_byte, 1) != HAL_OK)
-    {   return 0;   }
+    HAL_UART_Receive_IT((_IFACE*)(this->iface), &(this->rx_byte), 1);
 }
 
-/**
- * @details
- * This function fires on each UART Tx completion.
- */
-static void HAL_UART_TxCpltCallback(UART_HandleTypeDef *UartHandle)
-{}
+/*****************************************************************************/
+
+/* HAL UART Operation Callbacks */
+
+#if !defined(MINBASECLI_STM32_NO_UART_CALLBACKS)
 
 /**
  * @details
- * This function fires on any UART error.
+ * This function fires on each UART Rx reception, and pass it to the CLI of
+ * the UART (it overrides the weak HAL callback, so define
+ * MINBASECLI_STM32_NO_UART_CALLBACKS and call uart_rx_callback() from the
+ * application callback if other UARTs receptions are handled).
  */
-static void HAL_UART_ErrorCallback(UART_HandleTypeDef* UartHandle)
-{}
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef* UartHandle)
+{
+    MINBASECLI_STM32::uart_rx_callback(UartHandle);
+}
+
+#endif
 
 /*****************************************************************************/
 
@@ -47,6 +47,45 @@
 
 /* Libraries */
 
+// Device/Framework Libraries
+#if defined(STM32F0)
+    #include "stm32f0xx_hal.h"
+#elif defined(STM32F1)
+    #include "stm32f1xx_hal.h"
+#elif defined(STM32F2)
+    #include "stm32f2xx_hal.h"
+#elif defined(STM32F3)
+    #include "stm32f3xx_hal.h"
+#elif defined(STM32F4)
+    #include "stm32f4xx_hal.h"
+#elif defined(STM32F7)
+    #include "stm32f7xx_hal.h"
+#elif defined(STM32L0)
+    #include "stm32l0xx_hal.h"
+#elif defined(STM32L1)
+    #include "stm32l1xx_hal.h"
+#elif defined(STM32L4)
+    #include "stm32l4xx_hal.h"
+#elif defined(STM32L5)
+    #include "stm32l5xx_hal.h"
+#elif defined(STM32G0)
+    #include "stm32g0xx_hal.h"
+#elif defined(STM32G4)
+    #include "stm32g4xx_hal.h"
+#elif defined(STM32H7)
+    #include "stm32h7xx_hal.h"
+#elif defined(STM32U5)
+    #include "stm32u5xx_hal.h"
+#elif defined(STM32MP1)
+    #include "stm32mp1xx_hal.h"
+#elif defined(STM32WL)
+    #include "stm32wlxx_hal.h"
+#elif defined(STM32WB)
+    #include "stm32wbxx_hal.h"
+#else
+    #error "minbasecli_stm32 - Unsupported device/system."
+#endif
+
 // Standard C/C++ libraries
 #include <stdint.h>
 #include <stdbool.h>
@@ -56,12 +95,35 @@
 
 /* Constants & Defines */
 
+// Interface Element Data Type
+#define _IFACE UART_HandleTypeDef
+
+// Number of bytes that can be stored in each UART reception ring buffer
+// (it must be a power of two)
+#if !defined(MINBASECLI_STM32_RX_BUFFER_SIZE)
+    #define MINBASECLI_STM32_RX_BUFFER_SIZE 64
+#endif
+
+// Number of bytes of each UART non-blocking transmission buffer
+#if !defined(MINBASECLI_STM32_TX_BUFFER_SIZE)
+    #define MINBASECLI_STM32_TX_BUFFER_SIZE 64
+#endif
+
+// Maximum number of CLIs (UARTs) whose reception interrupts are dispatched
+#if !defined(MINBASECLI_STM32_MAX_UARTS)
+    #define MINBASECLI_STM32_MAX_UARTS 4
+#endif
+
 /*****************************************************************************/
 
 /* Class Interface */
 
 /**
  * @brief MINBASECLI_STM32 Class.
+ * Each object has its own UART (the handle provided to setup()) and its own
+ * reception and transmission buffers, so several CLIs can be used at the
+ * same time (i.e. one for each UART). The HAL UART callbacks dispatch each
+ * interrupt to the CLI of its UART handle.
  */
 class MINBASECLI_STM32
 {
@@ -76,6 +138,17 @@ class MINBASECLI_STM32
          */
         MINBASECLI_STM32();
 
+        /**
+         * @brief Handle a UART reception complete interrupt, passing it to
+         * the CLI of the UART. It is called by the HAL_UART_RxCpltCallback()
+         * of the library, or by the application one if the library callbacks
+         * are disabled (MINBASECLI_STM32_NO_UART_CALLBACKS defined).
+         * @param huart The UART handle of the interrupt.
+         * @return true if the UART is used by a CLI.
+         * @return false if the UART is not used by any CLI.
+         */
+        static bool uart_rx_callback(UART_HandleTypeDef* huart);
+
     /*************************************************************************/
 
     /* Protected Methods */
@@ -84,8 +157,9 @@ class MINBASECLI_STM32
 
         /**
          * @brief Configure the interface and communication speed of the CLI.
-         * @param iface Pointer to interface element that will be used by the
-         * CLI.
+         * @param iface Pointer to the UART handle (UART_HandleTypeDef) that
+         * will be used by the CLI (the default UART is used if its Instance
+         * is not set).
          * @param baud_rate Communication speed for the CLI.
          * @return true Interface configuration success.
          * @return false Interface configuration fail.
@@ -97,19 +171,93 @@ class MINBASECLI_STM32
          * are available in the current interface buffer to be read.
          * @return size_t The number of bytes available to be read.
          */
-        size_t hal_iface_available();
+        size_t hal_iface_available()
+        {   return (uint16_t)(this->rx_head - this->rx_tail);   }
 
         /**
          * @brief Get/read a byte from the interface.
          * @return uint8_t The byte read.
          */
-        uint8_t hal_iface_read();
+        uint8_t hal_iface_read()
+        {
+            uint8_t data_byte = 0;
+
+            hal_iface_read_bulk(&data_byte, 1U);
+            return data_byte;
+        }
+
+        /**
+         * @brief Get/read all the available bytes from the interface (up to
+         * a maximum number of bytes).
+         * @param data Pointer to the buffer to store the read bytes.
+         * @param data_max Maximum number of bytes to read.
+         * @return size_t The number of bytes read.
+         */
+        size_t hal_iface_read_bulk(uint8_t* data, const size_t data_max)
+        {
+            uint16_t head = this->rx_head;
+            uint16_t tail = this->rx_tail;
+            size_t data_len = 0U;
+
+            // Pop all the available bytes (up to the maximum)
+            while ( (data_len < data_max) && (tail != head) )
+            {
+                data[data_len] = this->rx_buffer[tail &
+                        (MINBASECLI_STM32_RX_BUFFER_SIZE - 1U)];
+                tail = tail + 1U;
+                data_len = data_len + 1U;
+            }
+            this->rx_tail = tail;
+
+            return data_len;
+        }
+
+        /**
+         * @brief Get the number of received bytes that have been discarded
+         * because the interface reception buffer was full.
+         * @return uint32_t The number of dropped bytes.
+         */
+        uint32_t hal_iface_rx_dropped()
+        {   return this->rx_dropped;   }
+
+        /**
+         * @brief Wait until the interface has received data to be read, or
+         * until a timeout expires.
+         * @param timeout_ms Maximum time to wait (milliseconds).
+         * @return true if there is received data available to be read.
+         * @return false if the timeout has expired without received data.
+         */
+        bool hal_iface_wait(const uint32_t timeout_ms);
+
+        /**
+         * @brief Get a free-running monotonic time (microseconds) to measure
+         * elapsed times (it wraps around every ~71 minutes).
+         * @return uint32_t The current time (microseconds).
+         */
+        uint32_t hal_time_us();
 
         /**
          * @brief Write a byte to the interface.
          * @param data_byte The byte to be written.
          */
-        void hal_iface_print(const uint8_t data_byte);
+        void hal_iface_print(const uint8_t data_byte)
+        {   hal_iface_write(&data_byte, 1U);   }
+
+        /**
+         * @brief Write a block of bytes to the interface.
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         */
+        void hal_iface_write(const uint8_t* data, const size_t data_len);
+
+        /**
+         * @brief Write a block of bytes to the interface without blocking
+         * (just the part of it that the interface can accept now).
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         * @return size_t The number of bytes written.
+         */
+        size_t hal_iface_try_write(const uint8_t* data, const size_t data_len);
 
     /*************************************************************************/
 
@@ -122,6 +270,36 @@ class MINBASECLI_STM32
          */
         void* iface;
 
+        /**
+         * @brief UART reception ring buffer (written from the reception
+         * interrupt).
+         */
+        uint8_t rx_buffer[MINBASECLI_STM32_RX_BUFFER_SIZE];
+
+        /**
+         * @brief Reception ring buffer write and read free-running indexes
+         * (the head is just modified by the interrupt and the tail by the
+         * CLI).
+         */
+        volatile uint16_t rx_head;
+        volatile uint16_t rx_tail;
+
+        /**
+         * @brief Number of received bytes discarded because the reception
+         * ring buffer was full.
+         */
+        volatile uint32_t rx_dropped;
+
+        /**
+         * @brief Last received byte (interrupt driven reception buffer).
+         */
+        uint8_t rx_byte;
+
+        /**
+         * @brief Bytes buffer of the ongoing non-blocking transmission.
+         */
+        uint8_t tx_buffer[MINBASECLI_STM32_TX_BUFFER_SIZE];
+
     /*************************************************************************/
 
     /* Private Methods */
@@ -139,6 +317,12 @@ class MINBASECLI_STM32
          */
         bool uart_setup(const uint32_t baud_rate,
                 const bool self_initialization=true);
+
+        /**
+         * @brief Store the received byte into the reception ring buffer and
+         * restart the interrupt driven reception of the next one.
+         */
+        void uart_rx_complete();
 };
 
 /*****************************************************************************/
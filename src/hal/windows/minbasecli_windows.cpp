@@ -42,28 +42,46 @@
 // Header Interface
 #include "minbasecli_windows.h"
 
-// Device/Framework Libraries
+// Tracing Hooks
+#include "../../minbasecli_trace.h"
+
+// Device/Framework Libraries (CancelSynchronousIo() requires Windows Vista)
+#if !defined(_WIN32_WINNT) || (_WIN32_WINNT < 0x0600)
+    #undef _WIN32_WINNT
+    #define _WIN32_WINNT 0x0600
+#endif
 #include <windows.h>
 
 // Standard Libraries
+#include <atomic>
 #include <iostream>
 #include <string.h>
 #include <stdio.h>      // getchar(), printf()
 
 /*****************************************************************************/
 
-/* Read STDIN Stream Thread Prototype */
+/* In-Scope Static Private */
+
+// STDIN stream is read by a CLI (it can't be shared between read threads)
+static std::atomic<bool> stdin_in_use(false);
+
+// Time between the read thread blocking read cancellations while it is
+// stopped (milliseconds)
+static const DWORD TH_RX_STOP_RETRY_MS = 10;
+
+/*****************************************************************************/
+
+/* Read Interface Thread Prototype */
 
 /**
- * @brief Windows Thread handler function to read STDIN data from the
- * interface.
+ * @brief Windows Thread handler function to read data from the interface.
  * @param arg Windows Thread arguments.
  */
-DWORD WINAPI th_read_stdin(LPVOID lpParam);
+DWORD WINAPI th_read_iface(LPVOID lpParam);
 
 /*****************************************************************************/
 
-/* Constructor */
+/* Constructor & Destructor */
 
 /**
  * @details
@@ -72,9 +90,37 @@ DWORD WINAPI th_read_stdin(LPVOID lpParam);
 MINBASECLI_WINDOWS::MINBASECLI_WINDOWS()
 {
     this->iface = NULL;
-    this->th_rx_read_head = 0;
-    this->th_rx_read_tail = 0;
-    this->th_rx_read[0] = '\0';
+    this->th_running = false;
+    this->th_rx_handle = NULL;
+    this->th_rx_thread = NULL;
+    this->th_rx_stop.store(false);
+    this->th_rx_event = (void*)(CreateEvent(NULL, FALSE, FALSE, NULL));
+    this->th_rx_space_event = (void*)(CreateEvent(NULL, FALSE, FALSE, NULL));
+}
+
+/**
+ * @details
+ * This destructor stops the interface read thread (its blocking read is
+ * cancelled until it ends, as it can be cancelled before the thread enters
+ * it, and the space event is set if it is waiting for free space in the read
+ * ring buffer), and then releases the STDIN stream and the thread events.
+ */
+MINBASECLI_WINDOWS::~MINBASECLI_WINDOWS()
+{
+    if (this->th_rx_thread != NULL)
+    {
+        this->th_rx_stop.store(true);
+        SetEvent((HANDLE)(this->th_rx_space_event));
+        while (WaitForSingleObject((HANDLE)(this->th_rx_thread),
+                TH_RX_STOP_RETRY_MS) == WAIT_TIMEOUT)
+        {   CancelSynchronousIo((HANDLE)(this->th_rx_thread));   }
+        CloseHandle((HANDLE)(this->th_rx_thread));
+    }
+    if (this->th_running && (this->th_rx_handle == NULL))
+    {   stdin_in_use.store(false);   }
+
+    CloseHandle((HANDLE)(this->th_rx_event));
+    CloseHandle((HANDLE)(this->th_rx_space_event));
 }
 
 /*****************************************************************************/
@@ -84,55 +130,118 @@ MINBASECLI_WINDOWS::MINBASECLI_WINDOWS()
 /**
  * @details
  * This function should get and initialize the interface element that is going
- * to be used by the CLI and it also start the STDIN data read thread.
+ * to be used by the CLI (the provided handle or STDIN/STDOUT) and it also
+ * start the interface data read thread. The interface can't be changed once
+ * the read thread is running, and the STDIN stream can't be used if other
+ * CLI is already reading it.
  */
 bool MINBASECLI_WINDOWS::hal_setup(void* iface, const uint32_t baud_rate)
 {
-    if (iface == NULL)
-    {   return false;   }
+    bool stdin_free = false;
+
+    if (this->th_running)
+    {   return (iface == this->iface);   }
 
+    if (iface == NULL)
+    {
+        if (!stdin_in_use.compare_exchange_strong(stdin_free, true))
+        {
+            printf("Fail to setup CLI: STDIN is used by other CLI\n");
+            return false;
+        }
+        this->th_rx_handle = NULL;
+    }
+    else
+    {   this->th_rx_handle = *((void**)(iface));   }
     this->iface = iface;
-    if (launch_stdin_read_thread() == false)
-    {   return false;   }
+
+    if (launch_read_thread() == false)
+    {
+        if (this->th_rx_handle == NULL)
+        {   stdin_in_use.store(false);   }
+        return false;
+    }
+    this->th_running = true;
 
     return true;
 }
 
 /**
  * @details
- * This function return the number of bytes received by the interface that are
- * available to be read.
+ * This function waits for the auto-reset event that the interface read
+ * thread
+ * sets when new data is pushed into the read ring buffer, until there is
+ * data available to be read or the timeout expires.
  */
-size_t MINBASECLI_WINDOWS::hal_iface_available()
+bool MINBASECLI_WINDOWS::hal_iface_wait(const uint32_t timeout_ms)
 {
-    return (this->th_rx_read_head - this->th_rx_read_tail);
+    // Don't wait if there is data available to be read
+    if (this->th_rx_ring.available() > 0)
+    {   return true;   }
+
+    WaitForSingleObject((HANDLE)(this->th_rx_event), (DWORD)(timeout_ms));
+
+    return (this->th_rx_ring.available() > 0);
 }
 
 /**
  * @details
- * This function returns a received byte from the interface. It checks if
- * there is any byte available to be read and increase the read circular
- * buffer tail index to "pop" this element from the buffer and return it.
+ * This function returns the performance counter time in microseconds.
  */
-uint8_t MINBASECLI_WINDOWS::hal_iface_read()
+uint32_t MINBASECLI_WINDOWS::hal_time_us()
 {
-    // Ignore if there is no available bytes to be read
-    if (hal_iface_available() == 0)
-    {   return 0;   }
-
-    // Return read bytes
-    this->th_rx_read_tail = (this->th_rx_read_tail + 1) %
-            MINBASECLI_MAX_READ_SIZE;
-    return th_rx_read[this->th_rx_read_tail];
+    LARGE_INTEGER counter;
+    LARGE_INTEGER frequency;
+    uint64_t ticks = 0U;
+    uint64_t freq = 0U;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    ticks = (uint64_t)(counter.QuadPart);
+    freq = (uint64_t)(frequency.QuadPart);
+    return (uint32_t)( ((ticks / freq) * 1000000ULL) +
+            (((ticks % freq) * 1000000ULL) / freq) );
 }
 
 /**
  * @details
- * This function send a byte through the interface.
+ * This function send a block of bytes through the interface. It writes the
+ * whole block to STDOUT stream with a single call and flush it, or to the
+ * interface handle until the whole block has been written.
  */
-void MINBASECLI_WINDOWS::hal_iface_print(const uint8_t data_byte)
+void MINBASECLI_WINDOWS::hal_iface_write(const uint8_t* data,
+        const size_t data_len)
 {
-    printf("%c", (char)(data_byte));
+    DWORD written = 0;
+    size_t total = 0U;
+
+    if (this->th_rx_handle == NULL)
+    {
+        fwrite(data, 1U, data_len, stdout);
+        fflush(stdout);
+        return;
+    }
+
+    while (total < data_len)
+    {
+        if (!WriteFile((HANDLE)(this->th_rx_handle), &(data[total]),
+                (DWORD)(data_len - total), &written, NULL))
+        {   return;   }
+        total = total + (size_t)(written);
+    }
+}
+
+/**
+ * @details
+ * This function writes the whole block of bytes through the interface (the
+ * console and synchronous handles have no non-blocking write, so it is the
+ * same than the blocking write).
+ */
+size_t MINBASECLI_WINDOWS::hal_iface_try_write(const uint8_t* data,
+        const size_t data_len)
+{
+    hal_iface_write(data, data_len);
+    return data_len;
 }
 
 /*****************************************************************************/
@@ -141,43 +250,120 @@ void MINBASECLI_WINDOWS::hal_iface_print(const uint8_t data_byte)
 
 /**
  * @details
- * This function create a Windows Thread to handle the STDIN data read from
- * the interface.
+ * This function create a Windows Thread to handle the data read from the
+ * interface (it is waited for on the CLI object destruction).
  */
-bool MINBASECLI_WINDOWS::launch_stdin_read_thread()
+bool MINBASECLI_WINDOWS::launch_read_thread()
 {
-    HANDLE thread = CreateThread(NULL, 0, th_read_stdin, (PVOID)(this),
+    HANDLE thread = CreateThread(NULL, 0, th_read_iface, (PVOID)(this),
             0, NULL);
     if (!thread)
     {
-        printf("Fail to create STDIN read thread\n");
+        printf("Fail to create interface read thread\n");
         return false;
     }
+    this->th_rx_thread = (void*)(thread);
 
     return true;
 }
 
+/**
+ * @details
+ * This function sets the event that the read thread waits for when the read
+ * ring buffer is full.
+ */
+void MINBASECLI_WINDOWS::th_rx_space_signal()
+{
+    SetEvent((HANDLE)(this->th_rx_space_event));
+}
+
 /*****************************************************************************/
 
-/* STDIN Read Thread */
+/* Read Interface Thread */
 
 /**
  * @details
- * This function is the Windows Thread that manages the STDIN data read.
- * It gets each new byte received from the interface and store them in the
- * read buffer (increasing the circular buffer head index).
+ * This function pushes a chunk of received data into the read ring buffer of
+ * a CLI, setting the data event for each pushed part, and waiting for the
+ * CLI to free space in the ring while the chunk doesn't fit. It returns
+ * false if the read thread is requested to stop meanwhile.
  */
-DWORD WINAPI th_read_stdin(LPVOID lpParam)
+static bool th_rx_push(MINBASECLI_WINDOWS* _this, const uint8_t* data,
+        const size_t data_len)
+{
+    size_t pushed = 0U;
+    size_t push_len = 0U;
+
+    while (pushed < data_len)
+    {
+        // Push the part of the chunk that fits in the ring
+        push_len = _this->th_rx_ring.push_fit(&(data[pushed]),
+                data_len - pushed);
+        pushed = pushed + push_len;
+        if (push_len > 0U)
+        {   MINBASECLI_TRACE_RX_POINT(_this, push_len);   }
+        SetEvent((HANDLE)(_this->th_rx_event));
+
+        // Wait for free space in the ring to push the rest
+        if (pushed < data_len)
+        {
+            while ( (_this->th_rx_ring.space_wait_begin() == 0U) &&
+                    (_this->th_rx_stop.load() == false) )
+            {
+                WaitForSingleObject((HANDLE)(_this->th_rx_space_event),
+                        INFINITE);
+            }
+            _this->th_rx_ring.space_wait_end();
+        }
+        if (_this->th_rx_stop.load())
+        {   return false;   }
+    }
+
+    return true;
+}
+
+/**
+ * @details
+ * This function is the Windows Thread that manages the interface data read.
+ * It gets each new byte received from STDIN, or each chunk of data received
+ * from the interface handle, and push it into the read ring buffer of its
+ * CLI, and signals it to any thread that is waiting for data. If the data
+ * doesn't fit in the ring, it waits for the CLI to get data from the ring
+ * (the interface is not read meanwhile, so no received data is dropped).
+ * The thread ends when it is requested to stop (its blocking read is
+ * cancelled), when the end of the input is reached (a read of zero bytes, so
+ * serial ports handles must be setup with blocking read timeouts) or on a
+ * read error.
+ */
+DWORD WINAPI th_read_iface(LPVOID lpParam)
 {
     MINBASECLI_WINDOWS* _this = (MINBASECLI_WINDOWS*) lpParam;
-    uint8_t new_head = 0;
+    uint8_t rx_chunk[MINBASECLI_RX_RING_SIZE];
+    DWORD rx_chunk_len = 0;
+    int ch = EOF;
 
-    while (true)
+    while (_this->th_rx_stop.load() == false)
     {
-        new_head = (_this->th_rx_read_head + 1) % MINBASECLI_MAX_READ_SIZE;
-        _this->th_rx_read[new_head] = getc(stdin);
-        _this->th_rx_read_head = new_head;
+        if (_this->th_rx_handle == NULL)
+        {
+            ch = getc(stdin);
+            if (ch == EOF)
+            {   break;   }
+            rx_chunk[0] = (uint8_t)(ch);
+            rx_chunk_len = 1;
+        }
+        else
+        {
+            if ( !ReadFile((HANDLE)(_this->th_rx_handle), rx_chunk,
+                    sizeof(rx_chunk), &rx_chunk_len, NULL) ||
+                 (rx_chunk_len == 0) )
+            {   break;   }
+        }
+        if (th_rx_push(_this, rx_chunk, (size_t)(rx_chunk_len)) == false)
+        {   break;   }
     }
+
+    return 0;
 }
 
 /*****************************************************************************/
@@ -46,13 +46,21 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <atomic>
+
+// Read Thread Reception Ring Buffer
+#include "../common/minbasecli_spsc_ring.h"
 
 /*****************************************************************************/
 
 /* Constants & Defines */
 
-// Maximum number of bytes that can be stored in thread data read buffer
-#define MINBASECLI_MAX_READ_SIZE 64
+// Number of bytes that can be stored in thread data read ring buffer
+// (it must be a power of two)
+#if !defined(MINBASECLI_RX_RING_SIZE)
+    #define MINBASECLI_RX_RING_SIZE 256
+#endif
 
 /*****************************************************************************/
 
@@ -60,6 +68,10 @@
 
 /**
  * @brief MINBASECLI_WINDOWS Class.
+ * Each object reads its own interface handle (STDIN or the one provided to
+ * setup(), i.e. a COM port or a pipe) from its own read thread, so several
+ * CLIs can run in the same process without sharing any state. The STDIN
+ * stream can be used just by one of them.
  */
 class MINBASECLI_WINDOWS
 {
@@ -70,19 +82,32 @@ class MINBASECLI_WINDOWS
     public:
 
         /**
-         * @brief Read buffer to store data from STDIN read thread.
+         * @brief Interface handle (HANDLE) read by the read thread (NULL for
+         * STDIN stream).
+         */
+        void* th_rx_handle;
+
+        /**
+         * @brief Ring buffer to store data from the read thread.
+         */
+        MINBASECLI_SPSC_RING<MINBASECLI_RX_RING_SIZE> th_rx_ring;
+
+        /**
+         * @brief Auto-reset event (HANDLE) set by the read thread each time
+         * that new data is pushed into th_rx_ring.
          */
-        char th_rx_read[MINBASECLI_MAX_READ_SIZE];
+        void* th_rx_event;
 
         /**
-         * @brief th_rx_read head index for circular buffer behaviour.
+         * @brief Auto-reset event (HANDLE) set by the CLI when it gets data
+         * from th_rx_ring while the read thread waits for free space.
          */
-        uint32_t th_rx_read_head;
+        void* th_rx_space_event;
 
         /**
-         * @brief th_rx_read tail index for circular buffer behaviour.
+         * @brief Read thread stop request.
          */
-        uint32_t th_rx_read_tail;
+        std::atomic<bool> th_rx_stop;
 
     /*************************************************************************/
 
@@ -95,6 +120,12 @@ class MINBASECLI_WINDOWS
          */
         MINBASECLI_WINDOWS();
 
+        /**
+         * @brief Destroy the minbasecli windows object, stopping its read
+         * thread and releasing its interface.
+         */
+        ~MINBASECLI_WINDOWS();
+
     /*************************************************************************/
 
     /* Protected Methods */
@@ -103,8 +134,8 @@ class MINBASECLI_WINDOWS
 
         /**
          * @brief Configure the interface and communication speed of the CLI.
-         * @param iface Pointer to interface element that will be used by the
-         * CLI.
+         * @param iface Pointer to the interface handle (HANDLE) that will be
+         * used by the CLI, or NULL to use STDIN and STDOUT.
          * @param baud_rate Communication speed for the CLI.
          * @return true Interface configuration success.
          * @return false Interface configuration fail.
@@ -116,19 +147,90 @@ class MINBASECLI_WINDOWS
          * are available in the current interface buffer to be read.
          * @return size_t The number of bytes available to be read.
          */
-        size_t hal_iface_available();
+        size_t hal_iface_available()
+        {   return this->th_rx_ring.available();   }
 
         /**
          * @brief Get/read a byte from the interface.
          * @return uint8_t The byte read.
          */
-        uint8_t hal_iface_read();
+        uint8_t hal_iface_read()
+        {
+            uint8_t data_byte = 0;
+
+            this->th_rx_ring.pop(&data_byte);
+            if (this->th_rx_ring.space_waited())
+            {   th_rx_space_signal();   }
+            return data_byte;
+        }
+
+        /**
+         * @brief Get/read all the available bytes from the interface (up to
+         * a maximum number of bytes).
+         * @param data Pointer to the buffer to store the read bytes.
+         * @param data_max Maximum number of bytes to read.
+         * @return size_t The number of bytes read.
+         */
+        size_t hal_iface_read_bulk(uint8_t* data, const size_t data_max)
+        {
+            size_t read_len = this->th_rx_ring.pop(data, data_max);
+
+            if (this->th_rx_ring.space_waited())
+            {   th_rx_space_signal();   }
+            return read_len;
+        }
+
+        /**
+         * @brief Get the number of received bytes that have been discarded
+         * because the interface reception buffer was full.
+         * @return uint32_t The number of dropped bytes.
+         */
+        uint32_t hal_iface_rx_dropped()
+        {   return this->th_rx_ring.dropped();   }
+
+        /**
+         * @brief Wait until the interface has received data to be read, or
+         * until a timeout expires.
+         * @param timeout_ms Maximum time to wait (milliseconds).
+         * @return true if there is received data available to be read.
+         * @return false if the timeout has expired without received data.
+         */
+        bool hal_iface_wait(const uint32_t timeout_ms);
+
+        /**
+         * @brief Get a free-running monotonic time (microseconds) to measure
+         * elapsed times (it wraps around every ~71 minutes).
+         * @return uint32_t The current time (microseconds).
+         */
+        uint32_t hal_time_us();
 
         /**
          * @brief Write a byte to the interface.
          * @param data_byte The byte to be written.
          */
-        void hal_iface_print(const uint8_t data_byte);
+        void hal_iface_print(const uint8_t data_byte)
+        {
+            if (this->th_rx_handle == NULL)
+            {   putchar((int)(data_byte));   }
+            else
+            {   hal_iface_write(&data_byte, 1U);   }
+        }
+
+        /**
+         * @brief Write a block of bytes to the interface.
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         */
+        void hal_iface_write(const uint8_t* data, const size_t data_len);
+
+        /**
+         * @brief Write a block of bytes to the interface without blocking
+         * (just the part of it that the interface can accept now).
+         * @param data Pointer to the bytes to be written.
+         * @param data_len Number of bytes to be written.
+         * @return size_t The number of bytes written.
+         */
+        size_t hal_iface_try_write(const uint8_t* data, const size_t data_len);
 
     /*************************************************************************/
 
@@ -141,6 +243,16 @@ class MINBASECLI_WINDOWS
          */
         void* iface;
 
+        /**
+         * @brief Interface read thread running flag.
+         */
+        bool th_running;
+
+        /**
+         * @brief Interface read thread (HANDLE).
+         */
+        void* th_rx_thread;
+
     /*************************************************************************/
 
     /* Private Methods */
@@ -148,11 +260,17 @@ class MINBASECLI_WINDOWS
     private:
 
         /**
-         * @brief Specific function to launch STDIN data read thread.
+         * @brief Specific function to launch the interface data read thread.
          * @return true if thread start result success.
          * @return false if thread start result fail.
          */
-        bool launch_stdin_read_thread();
+        bool launch_read_thread();
+
+        /**
+         * @brief Wake up the read thread that waits for free space in the
+         * read ring buffer.
+         */
+        void th_rx_space_signal();
 };
 
 /*****************************************************************************/
@@ -44,10 +44,52 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdarg.h>
 
 // Interface HAL Selection and configuration
 #include "minbasecli_hal_select.h"
 
+// CLI configurations (buffers sizes and limits of each CLI)
+#include "minbasecli_config.h"
+
+// Program memory (flash) strings access for AVR zero-copy commands
+#if defined(MINBASECLI_CMD_ZERO_COPY) && defined(__AVR)
+    #include <avr/pgmspace.h>
+    #define MINBASECLI_CMD_PROGMEM
+#endif
+
+// Floating point printf() conversions (%f), unless
+// MINBASECLI_DISABLE_PRINTF_FLOAT is defined (disabled by default on AVR
+// devices to save program memory, define MINBASECLI_PRINTF_FLOAT to use them)
+#if !defined(MINBASECLI_DISABLE_PRINTF_FLOAT) && !defined(__AVR)
+    #if !defined(MINBASECLI_PRINTF_FLOAT)
+        #define MINBASECLI_PRINTF_FLOAT
+    #endif
+#endif
+
+// Deferred binary logging: MINBASECLI_LOG() sends compact records (format
+// string ID, timestamp and raw arguments) that are rendered into text on the
+// host by tools/minbasecli_log.py, if MINBASECLI_LOG_BINARY is defined (GCC
+// ELF toolchains), or it just calls printf() otherwise
+#if defined(MINBASECLI_LOG_BINARY) && defined(__GNUC__) && defined(__ELF__)
+    #define MINBASECLI_LOG_DEFERRED
+#endif
+
+// Script files execution (memory-mapped or streamed from a file descriptor)
+// on Linux, unless MINBASECLI_DISABLE_SCRIPT_FILE is defined
+#if defined(__linux__) && !defined(MINBASECLI_DISABLE_SCRIPT_FILE)
+    #define MINBASECLI_SCRIPT_FILE
+#endif
+
+// Asynchronous commands executed by a worker threads pool (see
+// add_cmd_async()) on Linux, if MINBASECLI_CMD_ASYNC is defined
+#if defined(MINBASECLI_CMD_ASYNC)
+    #if !defined(__linux__)
+        #error "minbasecli - MINBASECLI_CMD_ASYNC is just supported on Linux."
+    #endif
+    #include <pthread.h>
+#endif
+
 /*****************************************************************************/
 
 /* Constants */
@@ -62,42 +104,281 @@ static const char CMD_HELP[] = "help";
  */
 static const char CMD_HELP_DESCRIPTION[] = "Shows current info.";
 
+#if defined(MINBASECLI_CMD_STATS)
+
+/**
+ * @brief Builtin command "stats" text.
+ */
+static const char CMD_STATS[] = "stats";
+
+/**
+ * @brief Builtin command "stats" description text.
+ */
+static const char CMD_STATS_DESCRIPTION[] =
+    "Shows commands calls and times (\"stats reset\" clears them).";
+
+/**
+ * @brief Number of buckets of the commands callbacks time histogram. The
+ * bucket N counts the calls that take less than 4^(N+1) microseconds (<4,
+ * <16, <64, <256, <1024, <4096 and <16384 us), and the last one the rest.
+ */
+static const uint8_t MINBASECLI_CMD_STATS_BUCKETS = 8U;
+
+#endif
+
+/**
+ * @brief CLI output policies when the transmission buffer is full and the
+ * interface can't accept more data (see set_tx_policy()):
+ * BLOCK - Wait until the interface sends the pending output.
+ * DROP_OLDEST - Discard the oldest pending output to store the new one.
+ * DROP_NEWEST - Discard the new output that doesn't fit.
+ * TRUNCATE - Discard the rest of the current command response.
+ */
+static const uint8_t MINBASECLI_TX_POLICY_BLOCK = 0U;
+static const uint8_t MINBASECLI_TX_POLICY_DROP_OLDEST = 1U;
+static const uint8_t MINBASECLI_TX_POLICY_DROP_NEWEST = 2U;
+static const uint8_t MINBASECLI_TX_POLICY_TRUNCATE = 3U;
+
+#if defined(MINBASECLI_CMD_ASYNC)
+
+/**
+ * @brief Asynchronous commands responses order (see set_async_order()):
+ * COMPLETION - Each response is sent as soon as its command ends.
+ * SUBMISSION - The responses are sent in the order that the commands were
+ * received (a response waits for the previous ones).
+ */
+static const uint8_t MINBASECLI_ASYNC_ORDER_COMPLETION = 0U;
+static const uint8_t MINBASECLI_ASYNC_ORDER_SUBMISSION = 1U;
+
+/**
+ * @brief Number of worker threads that execute the asynchronous commands.
+ */
+#if !defined(MINBASECLI_ASYNC_WORKERS)
+    #define MINBASECLI_ASYNC_WORKERS 2
+#endif
+
+/**
+ * @brief Maximum number of asynchronous commands queued or running (a
+ * received asynchronous command is rejected if all of them are in use).
+ */
+#if !defined(MINBASECLI_ASYNC_JOBS)
+    #define MINBASECLI_ASYNC_JOBS 8
+#endif
+
+/**
+ * @brief Output buffer size of each asynchronous command (the output that
+ * doesn't fit is discarded and counted).
+ */
+#if !defined(MINBASECLI_ASYNC_OUT_SIZE)
+    #define MINBASECLI_ASYNC_OUT_SIZE 1024
+#endif
+
+#endif
+
+/**
+ * @brief Default CLI output policy.
+ */
+#if !defined(MINBASECLI_TX_POLICY)
+    #define MINBASECLI_TX_POLICY MINBASECLI_TX_POLICY_BLOCK
+#endif
+
+#if defined(MINBASECLI_LOG_DEFERRED)
+
+/**
+ * @brief Maximum size of a deferred log record (arguments that doesn't fit
+ * are not sent, and strings are truncated).
+ */
+#if !defined(MINBASECLI_LOG_MAX_RECORD)
+    #define MINBASECLI_LOG_MAX_RECORD 64
+#endif
+#if (MINBASECLI_LOG_MAX_RECORD < 16) || (MINBASECLI_LOG_MAX_RECORD > 258)
+    #error "minbasecli - MINBASECLI_LOG_MAX_RECORD must be from 16 to 258."
+#endif
+
+/**
+ * @brief Deferred log records framing: sync byte, payload length, payload
+ * (format string ID, timestamp and arguments) and payload checksum (sum of
+ * its bytes). The sync byte is not an ASCII character, so records can be
+ * mixed with the CLI text output.
+ */
+static const uint8_t MINBASECLI_LOG_SYNC = 0xA5U;
+static const uint8_t MINBASECLI_LOG_HEADER_SIZE = 8U;
+
+/**
+ * @brief Deferred log record arguments type tags (high nibble, the low
+ * nibble is the value size in bytes). String arguments have a length byte
+ * after the tag, followed by its characters.
+ */
+static const uint8_t MINBASECLI_LOG_TAG_INT = 0x10U;
+static const uint8_t MINBASECLI_LOG_TAG_UINT = 0x20U;
+static const uint8_t MINBASECLI_LOG_TAG_FLOAT = 0x30U;
+static const uint8_t MINBASECLI_LOG_TAG_STR = 0x40U;
+static const uint8_t MINBASECLI_LOG_TAG_PTR = 0x50U;
+
+#endif
+
+/**
+ * @brief Added commands radix trie (multiple words commands paths and
+ * unique prefix dispatch), unless MINBASECLI_DISABLE_CMD_TRIE is defined.
+ * The trie has a root node and each added command creates two nodes at most
+ * (see MINBASECLI_CONFIG::CMD_TRIE_NODES). It is available for any CLI
+ * configuration, even if the default one can't add commands.
+ */
+#if !defined(MINBASECLI_DISABLE_CMD_TRIE)
+    #define MINBASECLI_CMD_TRIE
+#endif
+
 /*****************************************************************************/
 
 /* Data Types */
 
-// Forward Declaration of current class
-class MINBASECLI;
+// Forward Declaration of current class (CLI core over a HAL class with a
+// configuration), and the default CLI (core over the selected
+// device/framework HAL with the default configuration)
+template <class HAL, class CFG = MINBASECLI_DEFAULT_CONFIG>
+class MINBASECLI_CORE;
+typedef MINBASECLI_CORE<MINBASECLI_HAL> MINBASECLI;
+
+// CLI over the selected device/framework HAL with another configuration
+// Example: MINBASECLI_CFG< MINBASECLI_CONFIG<32, 16, 64, 4, 32> > DebugCli;
+template <class CFG>
+using MINBASECLI_CFG = MINBASECLI_CORE<MINBASECLI_HAL, CFG>;
 
-// Command callbacks type
+// Command callbacks type of the default CLI (see MINBASECLI_CORE::t_callback)
 typedef void (*t_command_callback)(MINBASECLI* Cli, int argc, char* argv[]);
 
-// Command function callback information
-typedef struct t_cmd_cb_info
+// CLI manage result data (for a configuration maximum number of arguments
+// and read buffer size)
+// Note: The command and arguments are null terminated strings that point to
+// the CLI read buffer, so they are valid until the next manage() or run()
+template <class CFG>
+struct t_cli_result_n
 {
-    char command[MINBASECLI_MAX_CMD_LEN];
-    char description[MINBASECLI_MAX_CMD_DESCRIPTION];
-    t_command_callback callback;
-} t_cmd_cb_info;
+    char* cmd;
+    char* argv[CFG::MAX_TOKENS];
+    typename CFG::t_word_len cmd_len;
+    typename CFG::t_word_len argv_len[CFG::MAX_TOKENS];
+    uint8_t argc;
+};
 
-// CLI manage result data
-typedef struct t_cli_result
+// Default CLI manage result data
+typedef t_cli_result_n<MINBASECLI_DEFAULT_CONFIG> t_cli_result;
+
+// CLI script execution statistics (accumulated through run_lines() calls)
+typedef struct t_cli_script_stats
 {
-    char cmd[MINBASECLI_MAX_CMD_LEN];
-    char argv[MINBASECLI_MAX_ARGV][MINBASECLI_MAX_ARGV_LEN];
-    uint8_t argc;
-} t_cli_result;
+    uint32_t lines;
+    uint32_t commands;
+    uint32_t unknown;
+    uint32_t truncated;
+} t_cli_script_stats;
+
+#if defined(MINBASECLI_CMD_STATS)
+
+// Added command callback calls statistics (times in microseconds, measured
+// with the HAL time around each callback call)
+typedef struct t_cli_cmd_stats
+{
+    uint32_t calls;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t histogram[MINBASECLI_CMD_STATS_BUCKETS];
+} t_cli_cmd_stats;
+
+#endif
+
+// Formatted output destination (the CLI output if str is NULL, or a string
+// buffer that always gets null terminated)
+typedef struct t_cli_fmt_out
+{
+    char* str;
+    size_t str_size;
+    size_t len;
+} t_cli_fmt_out;
+
+// Format conversion specification (flags, width and precision)
+typedef struct t_cli_fmt_spec
+{
+    uint8_t flags;
+    int width;
+    int precision;
+} t_cli_fmt_spec;
+
+#if defined(MINBASECLI_LOG_DEFERRED)
+
+// Deferred log record under construction
+typedef struct t_cli_log_rec
+{
+    uint8_t data[MINBASECLI_LOG_MAX_RECORD];
+    size_t len;
+    bool full;
+} t_cli_log_rec;
+
+#endif
+
+// Compile-time constant command tables
+#include "minbasecli_cmd_table.h"
+
+// Compile-time format strings
+#include "minbasecli_format.h"
+
+// Tracing hooks
+#include "minbasecli_trace.h"
 
 /*****************************************************************************/
 
 /* MinBaseCLI Class Interface */
 
 /**
- * @brief MINBASECLI Class.
- * Inherit from corresponding HAL CLI interface class.
+ * @brief MINBASECLI_CORE Class.
+ * Inherit from the provided HAL CLI interface class, whose methods are
+ * called statically (no virtual calls), so they can be inlined into the CLI
+ * core. MINBASECLI is the CLI core over the device/framework selected HAL,
+ * and any other HAL class that provides the same hal_*() methods can be used
+ * (see minbasecli_impl.h). The buffers sizes and limits are got from the
+ * CFG configuration class (see minbasecli_config.h), so CLIs with different
+ * sizes can be used in the same program.
  */
-class MINBASECLI : public MINBASECLI_HAL
+template <class HAL, class CFG>
+class MINBASECLI_CORE : public HAL
 {
+#if defined(MINBASECLI_CMD_STATS)
+    static_assert(CFG::MAX_CMD_TO_ADD > 0U,
+            "minbasecli - MINBASECLI_CMD_STATS requires added commands.");
+#endif
+#if defined(MINBASECLI_CMD_ASYNC)
+    static_assert(CFG::MAX_CMD_TO_ADD > 0U,
+            "minbasecli - MINBASECLI_CMD_ASYNC requires added commands.");
+#endif
+
+    /*************************************************************************/
+
+    /* Public Data Types */
+
+    public:
+
+        /**
+         * @brief Command callbacks type.
+         */
+        typedef void (*t_callback)(MINBASECLI_CORE* Cli, int argc,
+                char* argv[]);
+
+        /**
+         * @brief CLI manage result data type.
+         */
+        typedef t_cli_result_n<CFG> t_result;
+
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+
+        /**
+         * @brief Constant command table entry type (see
+         * minbasecli_cmd_table.h).
+         */
+        typedef t_cmd_table_entry_cb<t_callback> t_cmd_entry;
+
+#endif
+
     /*************************************************************************/
 
     /* Public Methods */
@@ -105,16 +386,26 @@ class MINBASECLI : public MINBASECLI_HAL
     public:
 
         /**
-         * @brief Construct a new MINBASECLI object.
+         * @brief Construct a new MINBASECLI_CORE object.
          */
-        MINBASECLI();
+        MINBASECLI_CORE();
+
+#if defined(MINBASECLI_CMD_ASYNC)
+        /**
+         * @brief Destroy the MINBASECLI_CORE object (the worker threads are
+         * stopped, see stop_async()).
+         */
+        ~MINBASECLI_CORE();
+#endif
 
         /**
          * @brief Configure the MINBASECLI object specifying the interface
          * element to use and the communication speed.
          * @param iface Pointer to Interface element to be used by the CLI.
          * @param baud_rate Communication speed for the CLI.
-         * @return Setup result success/fail (true/false).
+         * @return Setup result success/fail (true/false). With deferred
+         * logging, it also fails if the "minbasecli_log" section is bigger
+         * than 64 KiB (the format strings IDs are 16 bits offsets).
          */
         bool setup(
             void* iface=MINBASECLI_DEFAULT_IFACE,
@@ -134,10 +425,132 @@ class MINBASECLI : public MINBASECLI_HAL
          */
         bool add_cmd(
             const char* command,
-            t_command_callback callback,
+            t_callback callback,
+            const char* description
+        );
+
+#if defined(MINBASECLI_CMD_PROGMEM)
+
+        /**
+         * @brief Add and bind a new command to a callback function, with
+         * command and description texts stored in program memory (PROGMEM).
+         * @param command Program memory command text that fires the
+         * callback.
+         * @param callback Pointer to function that must be executed when the
+         * command text is received through the CLI.
+         * @param description Program memory command description text that
+         * will be shown on help command execution.
+         * @return true if the command has been successfully added/bind.
+         * @return false if the command can't be added/bind (the command
+         * already exists or there is no more memory space for a new command).
+         */
+        bool add_cmd_P(
+            PGM_P command,
+            t_callback callback,
+            PGM_P description
+        );
+
+#endif
+
+#if defined(MINBASECLI_CMD_ASYNC)
+
+        /**
+         * @brief Add and bind a new asynchronous command to a callback
+         * function. When the command is received, it is queued (the "[tag]
+         * queued" response is sent) and its callback is executed by a worker
+         * thread, with a copy of the arguments and its own output buffer, so
+         * the CLI keeps handling other commands while it runs. The output of
+         * the callback is sent by run(), run_batch() or iface_ready() when it
+         * ends, with the tag at the start of each line and a "[tag] done"
+         * line at the end.
+         * Note: The callback is called from a worker thread, so it must just
+         * use the CLI print functions and thread safe application data.
+         * @param command Command text that fires the callback.
+         * @param callback Pointer to function that must be executed when the
+         * command text is received through the CLI.
+         * @param description Command description text that will be shown on
+         * help command execution.
+         * @return true if the command has been successfully added/bind.
+         * @return false if the command can't be added/bind (the command
+         * already exists, there is no more memory space for a new command or
+         * the worker threads can't be created, and then the command is kept
+         * as a synchronous one).
+         */
+        bool add_cmd_async(
+            const char* command,
+            t_callback callback,
             const char* description
         );
 
+        /**
+         * @brief Set the order in which the asynchronous commands responses
+         * are sent (see MINBASECLI_ASYNC_ORDER_COMPLETION and SUBMISSION).
+         * @param order The responses order.
+         * @return true if the order has been set.
+         * @return false if the order is not valid.
+         */
+        bool set_async_order(const uint8_t order);
+
+        /**
+         * @brief Get the number of asynchronous commands that are queued,
+         * running or with its response pending to be sent.
+         * @return uint8_t The number of pending asynchronous commands.
+         */
+        uint8_t get_async_pending();
+
+        /**
+         * @brief Stop the worker threads, waiting for the running
+         * asynchronous commands to end (the queued ones are dropped, so
+         * they are never executed and no response is sent for them). It is
+         * called on the CLI object destruction, and it must not be called
+         * from an asynchronous command callback.
+         */
+        void stop_async();
+
+#endif
+
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+
+        /**
+         * @brief Set a compile-time constant command table to be handled by
+         * the CLI, in addition to the commands added through add_cmd().
+         * Note: The CLI keeps pointers to the table and to its commands
+         * array (they are not copied), so both must have static storage
+         * (declared "static constexpr" or at namespace scope, never as local
+         * variables of setup()). A temporary table is rejected at compile
+         * time.
+         * @param table The constant command table.
+         * @return true if the table has been successfully set.
+         * @return false if the table can't be set (a table command has
+         * already been added through add_cmd()).
+         */
+        template <size_t N>
+        bool set_cmd_table(const MINBASECLI_CMD_TABLE<N, t_callback>& table)
+        {   return set_cmd_table(table.info());   }
+
+        /**
+         * @brief A temporary constant command table can't be set (the CLI
+         * would keep pointers to a released table).
+         */
+        template <size_t N>
+        bool set_cmd_table(const MINBASECLI_CMD_TABLE<N, t_callback>&& table)
+            = delete;
+
+        /**
+         * @brief Set a compile-time constant command table to be handled by
+         * the CLI, in addition to the commands added through add_cmd().
+         * Note: The table information points to the table slots and
+         * displacement arrays and to its commands array, so they must have
+         * static storage (see the set_cmd_table() of a table).
+         * @param table The constant command table information.
+         * @return true if the table has been successfully set.
+         * @return false if the table can't be set (a table command has
+         * already been added through add_cmd()).
+         */
+        bool set_cmd_table(const t_cmd_table_cb<t_callback>& table);
+
+#endif
+
         /**
          * @brief Let the Command Line Interface run an execution iteration to
          * check if an added command has been received and then call the
@@ -152,186 +565,1418 @@ class MINBASECLI : public MINBASECLI_HAL
          * @brief Let the Command Line Interface run an execution iteration to
          * check for any incoming command from the CLI and get it.
          * @param cli_result Pointer to get the last received CLI command and
-         * arguments.
+         * arguments (pointers to the CLI read buffer, that are valid until
+         * the next manage() or run() call).
          * @return true if nay command has been received.
          * @return false If no command has been received.
          */
-        bool manage(t_cli_result* cli_result);
+        bool manage(t_result* cli_result);
 
         /**
-         * @brief CLI print a text with format support.
-         * @param str The text to be printed.
-         * @param ... Format arguments variables.
+         * @brief Block the caller until the CLI has received data to be
+         * handled, or until a timeout expires. It uses the interface wait
+         * mechanism of the device/framework (or polls the interface if there
+         * is none), so it can be used in the application loop instead of a
+         * delay between run() or manage() calls.
+         * @param timeout_ms Maximum time to wait (milliseconds).
+         * @return true if there is received data to be handled.
+         * @return false if the timeout has expired without received data.
          */
-        void printf(const char* str, ...);
+        bool wait_for_input(const uint32_t timeout_ms);
 
         /**
-         * @brief Internal builtin "help" command callback.
-         * @param argc Number of arguments.
-         * @param argv Pointers array of arguments.
+         * @brief Wait for the CLI to receive data (up to a timeout) and then
+         * run an execution iteration (see wait_for_input() and run()).
+         * @param timeout_ms Maximum time to wait (milliseconds).
+         * @return true if an added command has been detected and handled by
+         * callback.
+         * @return false if no added command has been detected.
          */
-        void cmd_help(int argc, char* argv[]);
+        bool run_wait(const uint32_t timeout_ms);
 
-    /*************************************************************************/
+        /**
+         * @brief Let the Command Line Interface handle a batch of received
+         * command lines in a single call, until no complete line remains,
+         * a maximum number of lines has been handled or a time budget runs
+         * out (checked after each line).
+         * @param max_lines Maximum number of lines to handle (0 for no
+         * limit).
+         * @param budget_us Time budget in microseconds (0 for no limit).
+         * @param pending Pointer to store if there is still received input
+         * pending to be handled (it can be NULL).
+         * @return uint32_t The number of command lines handled.
+         */
+        uint32_t run_batch(const uint32_t max_lines, const uint32_t budget_us,
+                bool* pending);
 
-    /* Private Attributes */
+        /**
+         * @brief Execute the command lines of a script in memory back to
+         * back (without the interface reception and without echo). Lines are
+         * terminated by LF or CRLF, and empty lines or lines that starts
+         * with '#' are skipped. The output is sent when the TX buffer gets
+         * full and at the end of the call.
+         * @param data Pointer to the script data (it is not modified).
+         * @param data_len Number of bytes of the script data.
+         * @param data_end Set if the data is the end of the script, so a last
+         * line without End-Of-Line is executed too (otherwise it is kept
+         * for the next call).
+         * @param stats Pointer to the statistics to be updated (it can be
+         * NULL).
+         * @return size_t The number of bytes consumed from the data (the
+         * ones after it are an incomplete line).
+         */
+        size_t run_lines(const char* data, const size_t data_len,
+                const bool data_end, t_cli_script_stats* stats);
 
-    private:
+#if defined(MINBASECLI_SCRIPT_FILE)
 
         /**
-         * @brief CLI initialized flag.
+         * @brief Execute a script file through run_lines(). Regular files
+         * are memory-mapped, and other files (i.e. pipes) are streamed until
+         * their end.
+         * @param path The script file path (NULL or "-" for STDIN).
+         * @param stats Pointer to the statistics to be updated (it can be
+         * NULL).
+         * @return true if the whole script has been executed.
+         * @return false if the file can't be opened or read.
          */
-        bool initialized;
+        bool run_file(const char* path, t_cli_script_stats* stats);
 
         /**
-         * @brief Number of bytes received through the CLI interface.
+         * @brief Execute a script streamed from a file descriptor (i.e. a
+         * pipe or socket) through run_lines(), until its end.
+         * @param fd The file descriptor to read.
+         * @param stats Pointer to the statistics to be updated (it can be
+         * NULL).
+         * @return true if the whole script has been executed.
+         * @return false if there is a read error.
          */
-        uint32_t received_bytes;
+        bool run_fd(const int fd, t_cli_script_stats* stats);
+
+#endif
 
         /**
-         * @brief Store if the builtin "help" command has been setup.
+         * @brief Let the Command Line Interface handle all the commands that
+         * have been received, calling the corresponding command function
+         * callbacks. It is intended to be called by event loops when the
+         * interface is ready to be read (i.e. poll()/epoll() of the
+         * get_iface_fd() file descriptor with the Linux poll HAL).
          */
-        bool use_builtin_help_cmd;
+        void iface_ready();
 
         /**
-         * @brief Current number of commands added to the CLI through add()
-         * function.
+         * @brief C-style readiness callback for event loops, that calls to
+         * iface_ready() of the provided CLI.
+         * @param cli Pointer to the CLI (MINBASECLI_CORE object).
          */
-        uint8_t num_added_commands;
+        static void iface_ready_callback(void* cli);
 
         /**
-         * @brief Array of commands that are added to be handle through
-         * callbacks by the add() function.
+         * @brief CLI print a text with format support (C standard printf()
+         * flags, width, precision, length modifiers and d, i, u, o, x, X, c,
+         * s, p, f, F and % conversions).
+         * @param str The text to be printed.
+         * @param ... Format arguments variables.
          */
-        t_cmd_cb_info added_commands[MINBASECLI_MAX_CMD_TO_ADD];
+        void printf(const char* str, ...) MINBASECLI_PRINTF_CHECK(2, 3);
 
         /**
-         * @brief Last received command result.
+         * @brief CLI print a text with format support, from a variadic
+         * arguments list (see printf()).
+         * @param str The text to be printed.
+         * @param lst Format arguments variables list.
          */
-        t_cli_result cli_result;
+        void vprintf(const char* str, va_list lst)
+                MINBASECLI_PRINTF_CHECK(2, 0);
 
         /**
-         * @brief CLI data reception buffer.
+         * @brief Write a text with format support into a string buffer (see
+         * printf()). The result is always null terminated and truncated to
+         * the buffer size.
+         * @param str Pointer to the string buffer.
+         * @param str_size Size of the string buffer.
+         * @param fstr The text to be written.
+         * @param ... Format arguments variables.
+         * @return int The length of the full formatted text (even if it has
+         * been truncated).
          */
-        char rx_read[MINBASECLI_MAX_READ_SIZE];
+        int snprintf(char* str, const size_t str_size, const char* fstr, ...)
+                MINBASECLI_PRINTF_CHECK(4, 5);
 
         /**
-         * @brief Format conversion buffer for printf.
+         * @brief Write a text with format support into a string buffer, from
+         * a variadic arguments list (see snprintf()).
+         * @param str Pointer to the string buffer.
+         * @param str_size Size of the string buffer.
+         * @param fstr The text to be written.
+         * @param lst Format arguments variables list.
+         * @return int The length of the full formatted text (even if it has
+         * been truncated).
          */
-        char print_array[MINBASECLI_MAX_PRINT_SIZE];
+        int vsnprintf(char* str, const size_t str_size, const char* fstr,
+                va_list lst) MINBASECLI_PRINTF_CHECK(4, 0);
 
-    /*************************************************************************/
+#if defined(MINBASECLI_FORMAT_SUPPORT)
 
-    /* Private Methods */
+        /**
+         * @brief CLI print a text with a compile-time format string (the
+         * printf() format specifications, without '*' width or precision).
+         * The format string is parsed and checked against the number and
+         * types of the arguments by the compiler, and the call gets just the
+         * writes of its literal texts and arguments conversions.
+         * Example: Cli.print(MINBASECLI_FMT("Temp: %5.1f C\n"), temp);
+         * @param fmt The format string (declared through MINBASECLI_FMT()).
+         * @param args Format arguments variables.
+         */
+        template <typename FMT, typename... ARGS>
+        void print(const FMT& fmt, const ARGS&... args)
+        {
+            static_assert(minbasecli_fmt_check<ARGS...>(FMT::str()) !=
+                    MINBASECLI_FMT_CHECK_INVALID,
+                    "minbasecli - Invalid or unsupported format string.");
+            static_assert(minbasecli_fmt_check<ARGS...>(FMT::str()) !=
+                    MINBASECLI_FMT_CHECK_ARGS_COUNT,
+                    "minbasecli - Format string conversions doesn't match "
+                    "the number of arguments.");
+            static_assert(minbasecli_fmt_check<ARGS...>(FMT::str()) !=
+                    MINBASECLI_FMT_CHECK_ARG_TYPE,
+                    "minbasecli - Format argument type doesn't match its "
+                    "conversion.");
+            (void)(fmt);
 
-    private:
+            fmt_emit<FMT, 0U>(args...);
+        }
+
+#endif
+
+#if defined(MINBASECLI_LOG_DEFERRED)
 
         /**
-         * @brief  Set attributes of a t_cli_result element to default null
-         * values.
-         * @param  cli_result The t_cli_result element to setup.
+         * @brief Send a deferred log record with the ID of a format string
+         * (its offset in the "minbasecli_log" section), the current time and
+         * the raw bytes of the arguments, without formatting them (use it
+         * through MINBASECLI_LOG(), which places the format string in that
+         * section).
+         * @param fstr The format string.
+         * @param args Format arguments variables.
          */
-        void set_default_result(t_cli_result* cli_result);
+        template <typename... ARGS>
+        void log_record(const char* fstr, const ARGS&... args)
+        {
+            t_cli_log_rec rec;
+
+            log_begin(&rec, fstr);
+            log_args(&rec, args...);
+            log_end(&rec);
+        }
+
+#endif
 
         /**
-         * @brief  Check if needed CLI interface is initialized.
-         * @return If interface is initialized (true or false).
+         * @brief Send all the pending output data of the CLI transmission
+         * buffer through the interface, waiting for the interface to accept
+         * it. With the BLOCK output policy it is called automatically when
+         * a new line is printed, when the buffer gets full, at the end of
+         * run() and at the start of manage() (drain_output() is called
+         * instead with the other policies).
          */
-        bool iface_is_not_initialized();
+        void flush();
 
         /**
-         * @brief  Return the current number of bytes received by
-         * iface_read_data().
-         * @return The number of bytes read.
+         * @brief Send the pending output data of the CLI transmission buffer
+         * that the interface can accept now, without blocking.
+         * @return size_t The number of bytes still pending to be sent.
          */
-        uint32_t get_received_bytes();
+        size_t drain_output();
 
         /**
-         * @brief  Check and read data from the CLI internal interface until
-         * EOL.
-         * @param  rx_read Read buffer to store the read data.
-         * @param  rx_read_size Max size of read buffer to be filled by read
-         * data.
-         * @return If end of line was received (true/false).
+         * @brief Set the CLI output policy for when the transmission buffer
+         * is full and the interface can't accept more data (see
+         * MINBASECLI_TX_POLICY_BLOCK, DROP_OLDEST, DROP_NEWEST and
+         * TRUNCATE).
+         * @param policy The output policy.
+         * @return true if the policy has been set.
+         * @return false if the policy is not valid.
          */
-        bool iface_read_data(char* rx_read, const size_t rx_read_size);
+        bool set_tx_policy(const uint8_t policy);
 
         /**
-         * @brief  Count the number of words inside a string.
-         * @param  str_in Input string from where to count words.
-         * @param  str_in_len Number of characters in "str_in".
-         * @return The number of words in the string.
+         * @brief Get the number of output bytes that have been discarded by
+         * the DROP_OLDEST and DROP_NEWEST output policies.
+         * @return uint32_t The number of dropped bytes.
          */
-        uint32_t str_count_words(const char* str_in, const size_t str_in_len);
+        uint32_t get_tx_dropped_bytes();
 
         /**
-         * @brief  Get substring from array until a specific character or end
-         * of string.
-         * @param  str Input string from where to get the substring.
-         * @param  str_len Number of characters in "str".
-         * @param  until_c Get substring until this character.
-         * @param  str_read Buffer to store the read substring.
-         * @param  str_read_size Max size of read buffer.
-         * @return If character "until_c" was found (true/false).
+         * @brief Get the number of output bytes that have been discarded by
+         * the TRUNCATE output policy.
+         * @return uint32_t The number of truncated bytes.
          */
-        bool str_read_until_char(
-            char* str,
-            const size_t str_len,
-            const char until_c,
-            char* str_read,
-            const size_t str_read_size
-        );
+        uint32_t get_tx_truncated_bytes();
 
         /**
-         * @brief Print a string.
-         * @param str The string to print.
+         * @brief Get the number of received bytes that the interface has
+         * discarded because its reception buffer was full.
+         * @return uint32_t The number of dropped bytes.
          */
-        void printstr(const char* str);
+        uint32_t get_rx_dropped_bytes();
 
         /**
-         * @brief  Convert a unsigned integer of 64 bits (uint64_t) into a
-         * string array.
-         * @param  num Unsigned integer to be converted.
-         * @param  str Pointer to array that gonna store the converted result
-         * string.
-         * @param  str_size Size of converted string array.
-         * @param  base Provided number base (binary, decimal, hexadecimal,
-         * etc.).
-         * @return Conversion result (false - fail; true - success).
-         */
-        bool u64toa(
-            uint64_t number,
-            char* str,
-            const uint8_t str_max_size,
-            const uint8_t base
-        );
+         * @brief Internal builtin "help" command callback. If arguments are
+         * provided, just the commands under that commands path are shown
+         * (i.e. "help net" shows "net if stats", "net if up", etc).
+         * @param argc Number of arguments.
+         * @param argv Pointers array of arguments.
+         */
+        void cmd_help(int argc, char* argv[]);
+
+#if defined(MINBASECLI_CMD_STATS)
 
         /**
-         * @brief  Convert a signed integer of 64 bits (int64_t) into a string
-         * array.
-         * @param  num Signed integer to be converted.
-         * @param  str Pointer to array that gonna store the converted result
-         * string.
-         * @param  str_size Size of converted string array.
-         * @param  base Provided number base (binary, decimal, hexadecimal,
-         * etc.).
-         * @return Conversion result (false - fail; true - success).
-         */
-        bool i64toa(
-            int64_t number,
-            char* str,
-            const uint8_t str_max_size,
-            const uint8_t base
-        );
+         * @brief Get a snapshot of the calls statistics of an added command
+         * (call it from the thread that runs the CLI).
+         * @param command The command text.
+         * @param stats Pointer to store the command statistics.
+         * @return true if the command statistics has been got.
+         * @return false if the command has not been added.
+         */
+        bool get_cmd_stats(const char* command, t_cli_cmd_stats* stats);
 
         /**
-         * @brief Reverse string characters ("ABCD" -> "DCBA").
-         * @param str Pointer to string to reverse and reversed string result.
-         * @param length Number of characters of the string.
-         * @return Operation result success/fail (true/false).
+         * @brief Clear the calls statistics of all the added commands.
          */
-        bool str_reverse(char* str, uint8_t length);
-};
+        void reset_cmd_stats();
+
+        /**
+         * @brief Internal builtin "stats" command callback. It shows the
+         * calls statistics of each added command, or clears them if the
+         * "reset" argument is provided.
+         * @param argc Number of arguments.
+         * @param argv Pointers array of arguments.
+         */
+        void cmd_stats(int argc, char* argv[]);
+
+#endif
+
+    /*************************************************************************/
+
+    /* Private Data Types */
+
+    private:
+
+        // Added commands index tag, it selects the hash index and commands
+        // trie functions (no index code is compiled for a configuration that
+        // can't add commands)
+        typedef MINBASECLI_BOOL_TAG<(CFG::MAX_CMD_TO_ADD > 0U)>
+                t_cmd_index_tag;
+
+        // Command function callback information
+        // Note: If MINBASECLI_CMD_ZERO_COPY is defined, the command and
+        // description texts are not copied and just the pointers to the
+        // caller strings are stored, so they must be static (never released
+        // or modified)
+        typedef struct t_cmd_cb_info
+        {
+#if defined(MINBASECLI_CMD_ZERO_COPY)
+            const char* command;
+            const char* description;
+#else
+            char command[CFG::MAX_CMD_LEN];
+            char description[CFG::MAX_CMD_DESCRIPTION];
+#endif
+            t_callback callback;
+            uint32_t hash;
+            uint16_t description_len;
+            uint8_t command_len;
+#if defined(MINBASECLI_CMD_PROGMEM)
+            bool progmem;
+#endif
+#if defined(MINBASECLI_CMD_STATS)
+            t_cli_cmd_stats stats;
+#endif
+#if defined(MINBASECLI_CMD_ASYNC)
+            bool async;
+#endif
+        } t_cmd_cb_info;
+
+#if defined(MINBASECLI_CMD_ASYNC)
+
+        // Asynchronous command execution (the line holds a copy of the
+        // command and arguments texts, and the output buffer its response)
+        typedef struct t_async_job
+        {
+            t_cmd_cb_info* cmd_cb_info;
+            char line[CFG::MAX_READ_SIZE];
+            char* argv[CFG::MAX_TOKENS];
+            int argc;
+            char out[MINBASECLI_ASYNC_OUT_SIZE];
+            size_t out_len;
+            uint32_t out_discarded;
+            char print_array[MINBASECLI_MAX_PRINT_SIZE];
+            uint32_t tag;
+            uint32_t done_seq;
+#if defined(MINBASECLI_CMD_STATS)
+            uint32_t elapsed_us;
+#endif
+            uint8_t state;
+        } t_async_job;
+
+#endif
+
+#if defined(MINBASECLI_CMD_TRIE)
+
+        // Command trie node index (the root is node 0, so 0 is used as "no
+        // node" in child and sibling links)
+        typedef typename MINBASECLI_INDEX_TYPE<
+                (CFG::CMD_TRIE_NODES <= 255U)>::type t_cmd_trie_idx;
+
+        // Command trie node, its label is a substring of an added command
+        // text
+        typedef struct t_cmd_trie_node
+        {
+            uint8_t cmd;
+            uint8_t label_start;
+            uint8_t label_len;
+            uint8_t terminal;
+            t_cmd_trie_idx child;
+            t_cmd_trie_idx sibling;
+        } t_cmd_trie_node;
+
+#endif
+
+    /*************************************************************************/
+
+    /* Private Attributes */
+
+    private:
+
+        /**
+         * @brief CLI initialized flag.
+         */
+        bool initialized;
+
+        /**
+         * @brief Number of bytes received through the CLI interface.
+         */
+        uint32_t received_bytes;
+
+        /**
+         * @brief Store if the builtin "help" command has been setup.
+         */
+        bool use_builtin_help_cmd;
+
+#if defined(MINBASECLI_CMD_STATS)
+
+        /**
+         * @brief Store if the builtin "stats" command has been setup.
+         */
+        bool use_builtin_stats_cmd;
+
+#endif
+
+        /**
+         * @brief Current number of commands added to the CLI through add()
+         * function.
+         */
+        uint8_t num_added_commands;
+
+        /**
+         * @brief Array of commands that are added to be handle through
+         * callbacks by the add() function.
+         */
+        t_cmd_cb_info added_commands[CFG::CMD_SLOTS];
+
+        /**
+         * @brief Open addressing hash index of added commands. Each slot
+         * stores the position of a command in added_commands[] plus one, so
+         * zero means an empty slot.
+         */
+        uint8_t cmd_hash_index[CFG::CMD_HASH_SIZE];
+
+#if defined(MINBASECLI_CMD_TRIE)
+
+        /**
+         * @brief Radix trie of added commands texts (node 0 is the root).
+         */
+        t_cmd_trie_node cmd_trie[CFG::CMD_TRIE_NODES];
+
+        /**
+         * @brief Current number of nodes of the commands trie.
+         */
+        t_cmd_trie_idx cmd_trie_num_nodes;
+
+        /**
+         * @brief Store if any added command has multiple words (then the
+         * trie must be used to get the longest matching commands path).
+         */
+        bool cmd_trie_multiword;
+
+#endif
+
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+
+        /**
+         * @brief Compile-time constant command table (no table set if its
+         * entries are NULL).
+         */
+        t_cmd_table_cb<t_callback> cmd_table;
+
+#endif
+
+        /**
+         * @brief Last received command result.
+         */
+        t_result cli_result;
+
+        /**
+         * @brief CLI data reception buffer.
+         */
+        char rx_read[CFG::MAX_READ_SIZE];
+
+        /**
+         * @brief Number of bytes stored in the reception buffer (the current
+         * line and any data received after it).
+         */
+        size_t rx_read_len;
+
+        /**
+         * @brief Position of the reception buffer where the data received
+         * after the last completed line starts (zero if there is no completed
+         * line in the buffer).
+         */
+        size_t rx_line_next;
+
+        /**
+         * @brief Store if the last completed line ended with a CR received at
+         * the end of a data chunk, so a LF at the start of the next chunk is
+         * part of its CRLF End-Of-Line.
+         */
+        bool rx_skip_lf;
+
+        /**
+         * @brief Format conversion buffer for printf.
+         */
+        char print_array[MINBASECLI_MAX_PRINT_SIZE];
+
+        /**
+         * @brief CLI output data transmission ring buffer.
+         */
+        uint8_t tx_buffer[CFG::MAX_TX_SIZE];
+
+        /**
+         * @brief Number of pending bytes in the transmission buffer.
+         */
+        size_t tx_buffer_len;
+
+        /**
+         * @brief Position of the transmission buffer where the pending
+         * bytes start (the oldest one).
+         */
+        size_t tx_buffer_tail;
+
+        /**
+         * @brief Output policy when the transmission buffer is full.
+         */
+        uint8_t tx_policy;
+
+        /**
+         * @brief Store if the rest of the current command response must be
+         * discarded (TRUNCATE output policy).
+         */
+        bool tx_truncating;
+
+        /**
+         * @brief Number of output bytes discarded by the DROP_OLDEST and
+         * DROP_NEWEST output policies.
+         */
+        uint32_t tx_dropped;
+
+        /**
+         * @brief Number of output bytes discarded by the TRUNCATE output
+         * policy.
+         */
+        uint32_t tx_truncated;
+
+        /**
+         * @brief Send the TX buffer at each new line (it is disabled while
+         * executing scripts, to send the output in full buffer blocks).
+         */
+        bool tx_line_flush;
+
+#if defined(MINBASECLI_CMD_ASYNC)
+
+        /**
+         * @brief Asynchronous commands executions.
+         */
+        t_async_job async_jobs[MINBASECLI_ASYNC_JOBS];
+
+        /**
+         * @brief Asynchronous commands executions lock, and condition to
+         * wake up the worker threads when a command is queued or they must
+         * stop.
+         */
+        pthread_mutex_t async_mutex;
+        pthread_cond_t async_cond;
+
+        /**
+         * @brief Worker threads, number of them running, and request to
+         * stop them.
+         */
+        pthread_t async_workers[MINBASECLI_ASYNC_WORKERS];
+        uint8_t async_num_workers;
+        bool async_stop;
+
+        /**
+         * @brief Asynchronous commands responses order.
+         */
+        uint8_t async_order;
+
+        /**
+         * @brief Tag of the next queued asynchronous command.
+         */
+        uint32_t async_next_tag;
+
+        /**
+         * @brief Sequence number of the next ended asynchronous command.
+         */
+        uint32_t async_next_done_seq;
+
+        /**
+         * @brief Asynchronous command executed by the current thread (NULL
+         * in the thread that runs the CLI), its output is written to the
+         * command output buffer instead of the transmission buffer.
+         */
+        static thread_local t_async_job* async_job;
+
+#endif
+
+    /*************************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief  Set attributes of a t_result element to default null
+         * values.
+         * @param  cli_result The t_result element to setup.
+         */
+        void set_default_result(t_result* cli_result);
+
+        /**
+         * @brief Handle the last received command (cli_result) by calling
+         * the corresponding command callback.
+         * @return true if the command is an added command and it has been
+         * handled by callback.
+         * @return false if the command is not an added command.
+         */
+        bool dispatch_cmd();
+
+        /**
+         * @brief  Get the hash (32 bits FNV-1a) of a command text.
+         * @param  command The command text.
+         * @return The command hash.
+         */
+        uint32_t cmd_hash(const char* command, size_t* command_len);
+
+        /**
+         * @brief  Add a new command callback information element to the list
+         * of added commands and to the hash index.
+         * @param  cmd_cb_info The command callback information element.
+         * @param  command RAM accessible command text of the element.
+         * @return If the command has been added (true/false).
+         */
+        bool cmd_register(const t_cmd_cb_info* cmd_cb_info,
+                const char* command);
+
+        /**
+         * @brief  Check if an added command has the provided command text.
+         * @param  cmd_cb_info The added command callback information element.
+         * @param  command The command text.
+         * @param  command_len Number of characters of the command text.
+         * @return If the command texts are equal (true/false).
+         */
+        bool cmd_equal(const t_cmd_cb_info* cmd_cb_info, const char* command,
+                const size_t command_len);
+
+        /**
+         * @brief  Search for an added command through the hash index.
+         * @param  command The command text to search for.
+         * @param  command_len Number of characters of the command text.
+         * @param  hash Hash of the command text.
+         * @return Pointer to the command callback information element, or
+         * NULL if the command has not been added.
+         */
+        t_cmd_cb_info* cmd_find(const char* command, const size_t command_len,
+                const uint32_t hash);
+
+        /**
+         * @brief  Search for an added command through the hash index (the
+         * tag selects the implementation, there is no hash index if no
+         * command can be added).
+         * @param  command The command text to search for.
+         * @param  command_len Number of characters of the command text.
+         * @param  hash Hash of the command text.
+         * @param  tag Added commands index tag (see t_cmd_index_tag).
+         * @return Pointer to the command callback information element, or
+         * NULL if the command has not been added.
+         */
+        template <class TAG>
+        t_cmd_cb_info* cmd_find(const char* command, const size_t command_len,
+                const uint32_t hash, TAG tag);
+        t_cmd_cb_info* cmd_find(const char* command, const size_t command_len,
+                const uint32_t hash, MINBASECLI_BOOL_TAG<false> tag);
+
+        /**
+         * @brief  Insert an added command into the hash index and the
+         * commands trie (the tag selects the implementation, there are no
+         * indexes if no command can be added).
+         * @param  cmd Added command position in added_commands[].
+         * @param  command RAM accessible command text of the command.
+         * @param  tag Added commands index tag (see t_cmd_index_tag).
+         */
+        template <class TAG>
+        void cmd_index_insert(const uint8_t cmd, const char* command,
+                TAG tag);
+        void cmd_index_insert(const uint8_t cmd, const char* command,
+                MINBASECLI_BOOL_TAG<false> tag);
+
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+
+        /**
+         * @brief  Search for a command in the constant command table through
+         * its perfect hash.
+         * @param  command The command text to search for.
+         * @param  hash Hash of the command text.
+         * @return Pointer to the command table entry, or NULL if the command
+         * is not in the table (or no table has been set).
+         */
+        const t_cmd_entry* cmd_table_find(const char* command,
+                const uint32_t hash);
+
+#endif
+
+        /**
+         * @brief  Check if there is any command to be handled through
+         * callbacks (added or from a constant command table).
+         * @return If there is any command (true/false).
+         */
+        bool any_cmd();
+
+        /**
+         * @brief  Print an added command text and description.
+         * @param  cmd_cb_info The added command callback information element.
+         */
+        void print_cmd_info(const t_cmd_cb_info* cmd_cb_info);
+
+#if defined(MINBASECLI_CMD_STATS)
+
+        /**
+         * @brief Add a callback call time to an added command statistics.
+         * @param stats The added command statistics.
+         * @param elapsed_us The callback call time (microseconds).
+         */
+        void cmd_stats_record(t_cli_cmd_stats* stats,
+                const uint32_t elapsed_us);
+
+        /**
+         * @brief Print an added command text and calls statistics.
+         * @param cmd_cb_info The added command callback information element.
+         */
+        void print_cmd_stats(const t_cmd_cb_info* cmd_cb_info);
+
+#endif
+
+#if defined(MINBASECLI_CMD_ASYNC)
+
+        /**
+         * @brief Queue the received command (cli_result) to be executed by a
+         * worker thread, copying its command and arguments texts.
+         * @param cmd_cb_info The added command callback information element.
+         * @param argc Number of arguments.
+         * @param argv Pointers array of arguments.
+         */
+        void async_submit(t_cmd_cb_info* cmd_cb_info, int argc,
+                char* argv[]);
+
+        /**
+         * @brief Send the responses of the ended asynchronous commands
+         * (following the responses order) and release them.
+         */
+        void async_emit();
+
+        /**
+         * @brief Check if there is any ended asynchronous command whose
+         * response can be sent.
+         * @param running Pointer to store if there is any asynchronous
+         * command queued or running (can be NULL).
+         * @return Pointer to the command execution, or NULL if there is not.
+         */
+        t_async_job* async_ready(bool* running);
+
+        /**
+         * @brief Worker thread loop, it executes the queued asynchronous
+         * commands (oldest first).
+         */
+        void async_worker();
+
+        /**
+         * @brief Worker thread entry point.
+         * @param cli The CLI object.
+         * @return NULL.
+         */
+        static void* async_worker_thread(void* cli);
+
+        /**
+         * @brief Add a block of bytes to the output buffer of the
+         * asynchronous command executed by the current thread.
+         * @param data Pointer to the bytes to add.
+         * @param data_len Number of bytes to add.
+         */
+        void async_write(const uint8_t* data, const size_t data_len);
+
+#endif
+
+#if defined(MINBASECLI_CMD_TRIE)
+
+        /**
+         * @brief  Get a character of an added command text.
+         * @param  cmd Added command position in added_commands[].
+         * @param  pos Character position in the command text.
+         * @return The character.
+         */
+        char cmd_text_char(const uint8_t cmd, const uint8_t pos);
+
+        /**
+         * @brief  Get a character of a commands trie node label.
+         * @param  node The trie node.
+         * @param  pos Character position in the node label.
+         * @param  tag Added commands index tag (see t_cmd_index_tag).
+         * @return The character.
+         */
+        template <class TAG>
+        char cmd_trie_label_char(const t_cmd_trie_idx node,
+                const uint8_t pos, TAG tag);
+
+        /**
+         * @brief  Insert an added command into the commands trie.
+         * @param  cmd Added command position in added_commands[].
+         * @param  tag Added commands index tag (see t_cmd_index_tag).
+         * @return If the command has been inserted (true/false).
+         */
+        template <class TAG>
+        bool cmd_trie_insert(const uint8_t cmd, TAG tag);
+
+        /**
+         * @brief  Get the child of a commands trie node whose label starts
+         * with a character.
+         * @param  node The trie node.
+         * @param  c The label first character.
+         * @param  tag Added commands index tag (see t_cmd_index_tag).
+         * @return The child node (or 0 if there is no such child).
+         */
+        template <class TAG>
+        t_cmd_trie_idx cmd_trie_child(const t_cmd_trie_idx node,
+                const char c, TAG tag);
+
+        /**
+         * @brief  Advance a commands trie position by one character.
+         * @param  node Current trie node (updated).
+         * @param  offset Number of matched characters of the node label
+         * (updated).
+         * @param  c The character to advance by.
+         * @param  tag Added commands index tag (see t_cmd_index_tag).
+         * @return If the trie has a path with that character (true/false).
+         */
+        template <class TAG>
+        bool cmd_trie_step(t_cmd_trie_idx* node, uint8_t* offset,
+                const char c, TAG tag);
+
+        /**
+         * @brief  Advance a commands trie position until the end of the
+         * current word if there is just one way to complete it.
+         * @param  node Current trie node (updated).
+         * @param  offset Number of matched characters of the node label
+         * (updated).
+         * @param  tag Added commands index tag (see t_cmd_index_tag).
+         * @return If the word is complete and not ambiguous (true/false).
+         */
+        template <class TAG>
+        bool cmd_trie_complete_word(t_cmd_trie_idx* node, uint8_t* offset,
+                TAG tag);
+
+        /**
+         * @brief  Search for the longest added commands path that matches
+         * the first received words, allowing unique abbreviations of each
+         * word.
+         * @param  cmd The received command (first word).
+         * @param  argc Number of received arguments (next words).
+         * @param  argv The received arguments.
+         * @param  words_used Number of words of the matched commands path.
+         * @param  tag Added commands index tag (see t_cmd_index_tag).
+         * @return Pointer to the command callback information element, or
+         * NULL if no added command matches (always NULL if no command can be
+         * added).
+         */
+        template <class TAG>
+        t_cmd_cb_info* cmd_trie_find(char* cmd, int argc, char* argv[],
+                uint8_t* words_used, TAG tag);
+        t_cmd_cb_info* cmd_trie_find(char* cmd, int argc, char* argv[],
+                uint8_t* words_used, MINBASECLI_BOOL_TAG<false> tag);
+
+        /**
+         * @brief  Print the text and description of each added command under
+         * a commands trie node.
+         * @param  node The trie node.
+         * @param  tag Added commands index tag (see t_cmd_index_tag).
+         */
+        template <class TAG>
+        void cmd_trie_print(const t_cmd_trie_idx node, TAG tag);
+
+        /**
+         * @brief  Print the commands under the provided commands path.
+         * @param  argc Number of words of the commands path.
+         * @param  argv The commands path words.
+         * @param  tag Added commands index tag (see t_cmd_index_tag).
+         * @return If any command has been found under the path (true/false,
+         * always false if no command can be added).
+         */
+        template <class TAG>
+        bool cmd_trie_help(int argc, char* argv[], TAG tag);
+        bool cmd_trie_help(int argc, char* argv[],
+                MINBASECLI_BOOL_TAG<false> tag);
+
+#endif
+
+        /**
+         * @brief  Check if needed CLI interface is initialized.
+         * @return If interface is initialized (true or false).
+         */
+        bool iface_is_not_initialized();
+
+        /**
+         * @brief  Return the current number of bytes received by
+         * iface_read_data().
+         * @return The number of bytes read.
+         */
+        uint32_t get_received_bytes();
+
+        /**
+         * @brief  Check and read data from the CLI internal interface until
+         * EOL.
+         * @param  rx_read Read buffer to store the read data.
+         * @param  rx_read_size Max size of read buffer to be filled by read
+         * data.
+         * @return If end of line was received (true/false).
+         */
+        bool iface_read_data(char* rx_read, const size_t rx_read_size);
+
+        /**
+         * @brief  Check if there is a complete line received after the last
+         * completed line in the read buffer.
+         * @return true if there is a received line pending to be handled.
+         * @return false if there is not.
+         */
+        bool iface_line_pending();
+
+        /**
+         * @brief  Split a received command line in place into its words
+         * (command and arguments), in a single pass.
+         * @param  str The received command line (its separators are replaced
+         * by null characters).
+         * @param  str_len Number of characters of the line.
+         * @param  cli_result Pointer to store the command and arguments.
+         */
+        void str_tokenize(char* str, const size_t str_len,
+                t_result* cli_result);
+
+        /**
+         * @brief Print a string.
+         * @param str The string to print.
+         */
+        void printstr(const char* str);
+
+        /**
+         * @brief Print a string of known length.
+         * @param str The string to print.
+         * @param str_len Number of characters to print.
+         */
+        void printstr(const char* str, const size_t str_len);
+
+#if defined(MINBASECLI_CMD_PROGMEM)
+
+        /**
+         * @brief Print a program memory (PROGMEM) string of known length.
+         * @param str The program memory string to print.
+         * @param str_len Number of characters to print.
+         */
+        void printstr_P(PGM_P str, const size_t str_len);
+
+#endif
+
+        /**
+         * @brief Add a byte to the transmission buffer (the buffer is sent if
+         * the byte is a new line character or if the buffer gets full).
+         * @param data_byte The byte to add.
+         */
+        void tx_put(const uint8_t data_byte);
+
+        /**
+         * @brief Get space in the transmission buffer for new output data,
+         * sending the pending data that the interface accepts and then
+         * applying the output policy if it is not enough.
+         * @param data_len Number of bytes of the new output data.
+         * @return size_t The number of bytes of the new output data that can
+         * be stored.
+         */
+        size_t tx_reserve(const size_t data_len);
+
+        /**
+         * @brief Copy a block of bytes into the free space of the
+         * transmission ring buffer.
+         * @param data Pointer to the bytes to copy.
+         * @param data_len Number of bytes to copy.
+         */
+        void tx_store(const uint8_t* data, const size_t data_len);
+
+        /**
+         * @brief Send the transmission buffer according to the output policy
+         * (flush() for BLOCK, drain_output() for the other ones).
+         */
+        void tx_send();
+
+        /**
+         * @brief Send the transmission buffer at the end of a command
+         * response (so the next response is not truncated).
+         */
+        void tx_response_end();
+
+        /**
+         * @brief Add a block of bytes to the transmission buffer (the buffer
+         * is sent if the block contains a new line character or each time the
+         * buffer gets full).
+         * @param data Pointer to the bytes to add.
+         * @param data_len Number of bytes to add.
+         */
+        void tx_write(const uint8_t* data, const size_t data_len);
+
+        /**
+         * @brief Format a text with the provided arguments and write it to
+         * an output destination.
+         * @param out Pointer to the output destination.
+         * @param fstr The text to be formatted.
+         * @param lst Format arguments variables list.
+         */
+        void fmt_vformat(t_cli_fmt_out* out, const char* fstr, va_list lst);
+
+        /**
+         * @brief Write a block of characters to an output destination.
+         * @param out Pointer to the output destination.
+         * @param data Pointer to the characters to write.
+         * @param data_len Number of characters to write.
+         */
+        void fmt_write(t_cli_fmt_out* out, const char* data,
+                const size_t data_len);
+
+        /**
+         * @brief Write a character repeatedly to an output destination.
+         * @param out Pointer to the output destination.
+         * @param c The character to write.
+         * @param count Number of times to write it.
+         */
+        void fmt_pad(t_cli_fmt_out* out, const char c, int count);
+
+        /**
+         * @brief Write a formatted integer number (sign or base prefix,
+         * precision zeros and width padding) to an output destination.
+         * @param out Pointer to the output destination.
+         * @param num Absolute value of the number.
+         * @param sign Sign character ('-', '+', ' ' or '\0' for none).
+         * @param base Number base (8, 10 or 16).
+         * @param spec Format conversion specification.
+         */
+        void fmt_integer(t_cli_fmt_out* out, const uint64_t num,
+                const char sign, const uint8_t base,
+                const t_cli_fmt_spec* spec);
+
+        /**
+         * @brief Write a string (limited by precision, with width padding) to
+         * an output destination.
+         * @param out Pointer to the output destination.
+         * @param str The string to write.
+         * @param spec Format conversion specification.
+         */
+        void fmt_string(t_cli_fmt_out* out, const char* str,
+                const t_cli_fmt_spec* spec);
+
+        /**
+         * @brief Write a character (with width padding) to an output
+         * destination.
+         * @param out Pointer to the output destination.
+         * @param c The character to write.
+         * @param spec Format conversion specification.
+         */
+        void fmt_char(t_cli_fmt_out* out, const char c,
+                const t_cli_fmt_spec* spec);
+
+#if defined(MINBASECLI_PRINTF_FLOAT)
+
+        /**
+         * @brief Write a formatted floating point number in fixed point
+         * notation to an output destination.
+         * @param out Pointer to the output destination.
+         * @param num The number.
+         * @param spec Format conversion specification.
+         */
+        void fmt_float(t_cli_fmt_out* out, double num,
+                const t_cli_fmt_spec* spec);
+
+#endif
+
+#if defined(MINBASECLI_FORMAT_SUPPORT)
+
+        /**
+         * @brief Write the compile-time format string segment that starts at
+         * a position (its literal text) and continue with what follows it.
+         * @param args Remaining format arguments variables.
+         */
+        template <typename FMT, size_t POS, typename... ARGS>
+        void fmt_emit(const ARGS&... args)
+        {
+            constexpr t_cli_fmt_conv seg =
+                    minbasecli_fmt_parse(FMT::str(), POS);
+
+            if (seg.literal_len > 0U)
+            {
+                tx_write((const uint8_t*)(&(FMT::str()[seg.literal])),
+                        seg.literal_len);
+            }
+            fmt_emit_step<FMT, POS>(MINBASECLI_FMT_STEP<seg.step>(),
+                    args...);
+        }
+
+        /**
+         * @brief Compile-time format string end (nothing else to write).
+         */
+        template <typename FMT, size_t POS, typename... ARGS>
+        void fmt_emit_step(MINBASECLI_FMT_STEP<MINBASECLI_FMT_STEP_END>,
+                const ARGS&...)
+        {}
+
+        /**
+         * @brief Compile-time format string segment that ends with a literal
+         * percent symbol (continue with the next segment).
+         * @param args Remaining format arguments variables.
+         */
+        template <typename FMT, size_t POS, typename... ARGS>
+        void fmt_emit_step(MINBASECLI_FMT_STEP<MINBASECLI_FMT_STEP_LITERAL>,
+                const ARGS&... args)
+        {
+            fmt_emit<FMT, minbasecli_fmt_parse(FMT::str(), POS).next>(
+                    args...);
+        }
+
+        /**
+         * @brief Compile-time format string segment that ends with a
+         * conversion (write the argument and continue with the next
+         * segment).
+         * @param arg Format argument variable of the conversion.
+         * @param args Remaining format arguments variables.
+         */
+        template <typename FMT, size_t POS, typename T, typename... ARGS>
+        void fmt_emit_step(MINBASECLI_FMT_STEP<MINBASECLI_FMT_STEP_ARG>,
+                const T& arg, const ARGS&... args)
+        {
+            static constexpr t_cli_fmt_conv seg =
+                    minbasecli_fmt_parse(FMT::str(), POS);
+
+            fmt_arg(arg, &seg,
+                    MINBASECLI_FMT_KIND<MINBASECLI_FMT_ARG<T>::KIND>());
+            fmt_emit<FMT, seg.next>(args...);
+        }
+
+        /**
+         * @brief Compile-time format string conversion without argument (it
+         * is reported by print() static checks).
+         */
+        template <typename FMT, size_t POS>
+        void fmt_emit_step(MINBASECLI_FMT_STEP<MINBASECLI_FMT_STEP_ARG>)
+        {}
+
+        /**
+         * @brief Write an integer argument of a compile-time format string
+         * conversion (with the sign of its type for 'd' and 'i', and the
+         * bits of its type for unsigned conversions).
+         * @param value The argument.
+         * @param seg Pointer to the format string segment of the conversion.
+         */
+        template <typename T>
+        void fmt_arg(const T& value, const t_cli_fmt_conv* seg,
+                MINBASECLI_FMT_KIND<MINBASECLI_FMT_ARG_INTEGER>)
+        {
+            t_cli_fmt_out out = { NULL, 0U, 0U };
+            uint64_t num = (uint64_t)(value);
+            char sign = '\0';
+            uint8_t base = 10U;
+
+            if ( (seg->conv == 'd') || (seg->conv == 'i') )
+            {
+                if (MINBASECLI_FMT_ARG<T>::SIGNED && ((int64_t)(value) < 0))
+                {
+                    sign = '-';
+                    num = (uint64_t)(0U) - num;
+                }
+                else if (seg->spec.flags & MINBASECLI_FMT_FLAG_PLUS)
+                {   sign = '+';   }
+                else if (seg->spec.flags & MINBASECLI_FMT_FLAG_SPACE)
+                {   sign = ' ';   }
+            }
+            else if (seg->conv == 'c')
+            {
+                fmt_char(&out, (char)(value), &(seg->spec));
+                return;
+            }
+            else
+            {
+                num = num & ((((uint64_t)(1U) << (4U * sizeof(T))) <<
+                        (4U * sizeof(T))) - 1U);
+                if (seg->conv == 'o')
+                {   base = 8U;   }
+                else if (seg->conv != 'u')
+                {   base = 16U;   }
+            }
+            fmt_integer(&out, num, sign, base, &(seg->spec));
+        }
+
+        /**
+         * @brief Write a string argument of a compile-time format string
+         * conversion (its address for 'p').
+         * @param value The argument.
+         * @param seg Pointer to the format string segment of the conversion.
+         */
+        template <typename T>
+        void fmt_arg(const T& value, const t_cli_fmt_conv* seg,
+                MINBASECLI_FMT_KIND<MINBASECLI_FMT_ARG_STRING>)
+        {
+            t_cli_fmt_out out = { NULL, 0U, 0U };
+
+            if (seg->conv == 'p')
+            {
+                fmt_integer(&out, (uint64_t)((uintptr_t)(value)), '\0', 16U,
+                        &(seg->spec));
+            }
+            else
+            {   fmt_string(&out, value, &(seg->spec));   }
+        }
+
+        /**
+         * @brief Write a pointer argument of a compile-time format string
+         * conversion.
+         * @param value The argument.
+         * @param seg Pointer to the format string segment of the conversion.
+         */
+        template <typename T>
+        void fmt_arg(const T& value, const t_cli_fmt_conv* seg,
+                MINBASECLI_FMT_KIND<MINBASECLI_FMT_ARG_POINTER>)
+        {
+            t_cli_fmt_out out = { NULL, 0U, 0U };
+
+            fmt_integer(&out, (uint64_t)((uintptr_t)(value)), '\0', 16U,
+                    &(seg->spec));
+        }
+
+        /**
+         * @brief Write a floating point argument of a compile-time format
+         * string conversion ("?" if floating point conversions are
+         * disabled).
+         * @param value The argument.
+         * @param seg Pointer to the format string segment of the conversion.
+         */
+        template <typename T>
+        void fmt_arg(const T& value, const t_cli_fmt_conv* seg,
+                MINBASECLI_FMT_KIND<MINBASECLI_FMT_ARG_FLOAT>)
+        {
+            t_cli_fmt_out out = { NULL, 0U, 0U };
+
+#if defined(MINBASECLI_PRINTF_FLOAT)
+            fmt_float(&out, (double)(value), &(seg->spec));
+#else
+            (void)(value);
+            (void)(seg);
+            fmt_write(&out, "?", 1U);
+#endif
+        }
+
+        /**
+         * @brief Not supported argument type of a compile-time format string
+         * conversion (it is reported by print() static checks).
+         */
+        template <typename T>
+        void fmt_arg(const T&, const t_cli_fmt_conv*,
+                MINBASECLI_FMT_KIND<MINBASECLI_FMT_ARG_NONE>)
+        {}
+
+#endif
+
+#if defined(MINBASECLI_LOG_DEFERRED)
+
+        /**
+         * @brief Start a deferred log record (format string ID and current
+         * time).
+         * @param rec Pointer to the record.
+         * @param fstr The format string (placed in the log section).
+         */
+        void log_begin(t_cli_log_rec* rec, const char* fstr);
+
+        /**
+         * @brief Add an argument to a deferred log record (type tag and raw
+         * bytes), if it fits.
+         * @param rec Pointer to the record.
+         * @param tag Argument type tag (without the size).
+         * @param value Pointer to the argument value.
+         * @param value_size Size of the argument value.
+         */
+        void log_arg_raw(t_cli_log_rec* rec, const uint8_t tag,
+                const void* value, const size_t value_size);
+
+        /**
+         * @brief Add a string argument to a deferred log record (type tag,
+         * length and characters, truncated to the record free space).
+         * @param rec Pointer to the record.
+         * @param str The string.
+         */
+        void log_arg_str(t_cli_log_rec* rec, const char* str);
+
+        /**
+         * @brief Complete a deferred log record (payload length and
+         * checksum) and write it to the CLI output.
+         * @param rec Pointer to the record.
+         */
+        void log_end(t_cli_log_rec* rec);
+
+        /**
+         * @brief Add the arguments of a deferred log record (end of the
+         * arguments).
+         */
+        void log_args(t_cli_log_rec*)
+        {}
+
+        /**
+         * @brief Add the arguments of a deferred log record, one by one.
+         * @param rec Pointer to the record.
+         * @param arg First argument.
+         * @param args Rest of arguments.
+         */
+        template <typename T, typename... ARGS>
+        void log_args(t_cli_log_rec* rec, const T& arg, const ARGS&... args)
+        {
+            log_arg(rec, arg);
+            log_args(rec, args...);
+        }
+
+        /**
+         * @brief Add an integer (or enumeration) argument to a deferred log
+         * record, tagged as signed or unsigned.
+         * @param rec Pointer to the record.
+         * @param value The argument value.
+         */
+        template <typename T>
+        void log_arg(t_cli_log_rec* rec, const T value)
+        {
+            log_arg_raw(rec, (((T)(-1) < (T)(0)) ?
+                    MINBASECLI_LOG_TAG_INT : MINBASECLI_LOG_TAG_UINT),
+                    &value, sizeof(T));
+        }
+
+        /**
+         * @brief Add a pointer argument to a deferred log record.
+         * @param rec Pointer to the record.
+         * @param value The argument value.
+         */
+        template <typename T>
+        void log_arg(t_cli_log_rec* rec, const T* value)
+        {   log_arg_raw(rec, MINBASECLI_LOG_TAG_PTR, &value, sizeof(value));   }
+
+        /**
+         * @brief Add a boolean argument to a deferred log record.
+         * @param rec Pointer to the record.
+         * @param value The argument value.
+         */
+        void log_arg(t_cli_log_rec* rec, const bool value)
+        {
+            uint8_t num = (value) ? 1U : 0U;
+            log_arg_raw(rec, MINBASECLI_LOG_TAG_UINT, &num, sizeof(num));
+        }
+
+        /**
+         * @brief Add a floating point argument to a deferred log record.
+         * @param rec Pointer to the record.
+         * @param value The argument value.
+         */
+        void log_arg(t_cli_log_rec* rec, const float value)
+        {
+            log_arg_raw(rec, MINBASECLI_LOG_TAG_FLOAT, &value, sizeof(value));
+        }
+
+        /**
+         * @brief Add a double floating point argument to a deferred log
+         * record (long doubles are sent as doubles).
+         * @param rec Pointer to the record.
+         * @param value The argument value.
+         */
+        void log_arg(t_cli_log_rec* rec, const double value)
+        {
+            log_arg_raw(rec, MINBASECLI_LOG_TAG_FLOAT, &value, sizeof(value));
+        }
+
+        void log_arg(t_cli_log_rec* rec, const long double value)
+        {   log_arg(rec, (double)(value));   }
+
+        /**
+         * @brief Add a string argument to a deferred log record.
+         * @param rec Pointer to the record.
+         * @param value The argument value.
+         */
+        void log_arg(t_cli_log_rec* rec, const char* value)
+        {   log_arg_str(rec, value);   }
+
+        void log_arg(t_cli_log_rec* rec, char* value)
+        {   log_arg_str(rec, value);   }
+
+#endif
+};
+
+/*****************************************************************************/
+
+/* Default CLI */
+
+// The default CLI core methods are compiled once (minbasecli.cpp)
+extern template class MINBASECLI_CORE<MINBASECLI_HAL>;
+
+/*****************************************************************************/
+
+/* Deferred Logging */
+
+/**
+ * @brief Log a formatted text through a CLI. With MINBASECLI_LOG_BINARY
+ * (deferred logging), the format string is placed in the "minbasecli_log"
+ * section (which is the strings table of the host decoder) and a binary
+ * record is sent instead of the text. Otherwise the text is formatted with
+ * printf(), so the same call sites are used in both cases.
+ * Example: MINBASECLI_LOG(Cli, "ADC %u: %d mV\n", channel, value);
+ */
+#if defined(MINBASECLI_LOG_DEFERRED)
+    #define MINBASECLI_LOG(cli, fstr, ...) \
+        do \
+        { \
+            static const char minbasecli_log_fstr[] \
+                __attribute__((section("minbasecli_log"), used)) = fstr; \
+            (cli).log_record(minbasecli_log_fstr, ##__VA_ARGS__); \
+        } while (0)
+#else
+    #define MINBASECLI_LOG(cli, fstr, ...) \
+        (cli).printf(fstr, ##__VA_ARGS__)
+#endif
 
 /*****************************************************************************/
 
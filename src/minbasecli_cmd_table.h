@@ -0,0 +1,434 @@
+
+/**
+ * @file    minbasecli_cmd_table.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * MINBASECLI compile-time constant command tables. A table is declared from
+ * a constexpr array of commands and the compiler generates a collision-free
+ * (perfect) hash for it, so the table, the hash and the strings can live in
+ * read-only memory and no command needs to be added at startup.
+ *
+ * Usage example (the CLI keeps pointers to the table and its commands, so
+ * both are declared with static storage, at namespace scope):
+ *
+ *   static constexpr t_cmd_table_entry COMMANDS[] =
+ *   {
+ *       { "test", &cmd_test, "test [on/off] - Turn test mode ON/OFF." },
+ *       { "version", &cmd_version, "Shows current application version." },
+ *   };
+ *   static constexpr auto CMD_TABLE = minbasecli_cmd_table(COMMANDS);
+ *
+ *   void setup()
+ *   {
+ *       Cli.setup();
+ *       Cli.set_cmd_table(CMD_TABLE);
+ *   }
+ *
+ * A table declared as a local variable of setup() can't be used (it is
+ * released when setup() returns), unless it is declared "static constexpr"
+ * there too.
+ *
+ * The entries of a CLI core over other HAL than the default one are declared
+ * with its command callbacks type (MINBASECLI_CORE<HAL>::t_cmd_entry).
+ *
+ * Note: This file is included by minbasecli.h after its data types, and
+ * tables are available when building with C++14 or newer.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef MINBASECLI_CMD_TABLE_H_
+#define MINBASECLI_CMD_TABLE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C/C++ libraries
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*****************************************************************************/
+
+/* Constants */
+
+#if (__cplusplus >= 201402L)
+
+/**
+ * @brief Constant command tables support is available.
+ */
+#define MINBASECLI_CMD_TABLE_SUPPORT
+
+/**
+ * @brief Maximum number of displacement values to test for each hash bucket
+ * while generating the perfect hash of a table.
+ */
+static const uint32_t MINBASECLI_CMD_TABLE_MAX_DISP = 65535U;
+
+/**
+ * @brief Multiplier to spread the displacement values of the hash buckets
+ * (32 bits golden ratio).
+ */
+static const uint32_t MINBASECLI_CMD_TABLE_DISP_MULT = 0x9E3779B9UL;
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// Constant command table entry (CB is the command callbacks type of the CLI)
+template <typename CB>
+struct t_cmd_table_entry_cb
+{
+    const char* command;
+    CB callback;
+    const char* description;
+};
+
+// Constant command table information used by the CLI for the lookup
+template <typename CB>
+struct t_cmd_table_cb
+{
+    const t_cmd_table_entry_cb<CB>* entries;
+    const uint8_t* slots;
+    const uint16_t* disp;
+    uint8_t num_entries;
+    uint16_t slots_mask;
+    uint16_t buckets_mask;
+};
+
+// Constant command table entry and information of the default CLI
+typedef t_cmd_table_entry_cb<t_command_callback> t_cmd_table_entry;
+typedef t_cmd_table_cb<t_command_callback> t_cmd_table;
+
+/*****************************************************************************/
+
+/* Compile-Time Functions */
+
+/**
+ * @brief Get the hash (32 bits FNV-1a) of a command text. It gives the same
+ * result than the CLI runtime command hash.
+ * @param command The command text.
+ * @return The command hash.
+ */
+constexpr uint32_t minbasecli_cmd_table_hash(const char* command)
+{
+    uint32_t hash = 2166136261UL;
+
+    while (*command != '\0')
+    {
+        hash = (hash ^ (uint8_t)(*command)) * 16777619UL;
+        command = command + 1;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Mix all bits of a hash value (Murmur3 32 bits finalizer).
+ * @param hash The hash value to mix.
+ * @return The mixed hash value.
+ */
+constexpr uint32_t minbasecli_cmd_table_mix(uint32_t hash)
+{
+    hash = hash ^ (hash >> 16);
+    hash = hash * 0x85EBCA6BUL;
+    hash = hash ^ (hash >> 13);
+    hash = hash * 0xC2B2AE35UL;
+    hash = hash ^ (hash >> 16);
+    return hash;
+}
+
+/**
+ * @brief Get the hash bucket of a command hash.
+ * @param hash The command hash.
+ * @param buckets_mask Number of buckets of the table minus one.
+ * @return The hash bucket.
+ */
+constexpr uint32_t minbasecli_cmd_table_bucket(const uint32_t hash,
+        const uint32_t buckets_mask)
+{
+    return (minbasecli_cmd_table_mix(hash) & buckets_mask);
+}
+
+/**
+ * @brief Get the table slot of a command hash for a bucket displacement.
+ * @param hash The command hash.
+ * @param disp Displacement value of the command hash bucket.
+ * @param slots_mask Number of slots of the table minus one.
+ * @return The table slot.
+ */
+constexpr uint32_t minbasecli_cmd_table_slot(const uint32_t hash,
+        const uint32_t disp, const uint32_t slots_mask)
+{
+    return (minbasecli_cmd_table_mix(hash + (disp *
+            MINBASECLI_CMD_TABLE_DISP_MULT)) & slots_mask);
+}
+
+/**
+ * @brief Get the lower power of two that is equal or higher than a value.
+ * @param value The value.
+ * @return The power of two.
+ */
+constexpr size_t minbasecli_cmd_table_pow2(const size_t value)
+{
+    size_t pow2 = 1U;
+
+    while (pow2 < value)
+    {   pow2 = pow2 << 1;   }
+
+    return pow2;
+}
+
+/**
+ * @brief Compare two strings.
+ * @param str_a First string.
+ * @param str_b Second string.
+ * @return If both strings are equal (true/false).
+ */
+constexpr bool minbasecli_cmd_table_str_equal(const char* str_a,
+        const char* str_b)
+{
+    while ( (*str_a != '\0') && (*str_a == *str_b) )
+    {
+        str_a = str_a + 1;
+        str_b = str_b + 1;
+    }
+
+    return (*str_a == *str_b);
+}
+
+/**
+ * @brief Compile-time error reporting function. It is not constexpr, so
+ * reaching it while building a table stops the compilation pointing here.
+ */
+void minbasecli_cmd_table_error_duplicated_command();
+
+/**
+ * @brief Compile-time error reporting function. It is not constexpr, so
+ * reaching it while building a table stops the compilation pointing here.
+ */
+void minbasecli_cmd_table_error_invalid_entry();
+
+/**
+ * @brief Compile-time error reporting function. It is not constexpr, so
+ * reaching it while building a table stops the compilation pointing here.
+ */
+void minbasecli_cmd_table_error_no_perfect_hash();
+
+/*****************************************************************************/
+
+/* Constant Command Table Class */
+
+/**
+ * @brief MINBASECLI_CMD_TABLE Class.
+ * Constant table of N commands with a compile-time generated perfect hash
+ * ("hash and displace": each command hash selects a bucket, and each bucket
+ * has a displacement value that places its commands in free table slots).
+ * CB is the command callbacks type of the CLI.
+ */
+template <size_t N, typename CB = t_command_callback>
+class MINBASECLI_CMD_TABLE
+{
+    static_assert( (N > 0U) && (N < 256U),
+            "minbasecli - Command tables must have from 1 to 255 commands.");
+
+    /*************************************************************************/
+
+    /* Public Constants */
+
+    public:
+
+        /**
+         * @brief Number of slots of the table.
+         */
+        static constexpr size_t SLOTS = minbasecli_cmd_table_pow2(N);
+
+        /**
+         * @brief Number of hash buckets of the table.
+         */
+        static constexpr size_t BUCKETS = (SLOTS > 1U) ? (SLOTS / 2U) : 1U;
+
+    /*************************************************************************/
+
+    /* Public Methods */
+
+    public:
+
+        /**
+         * @brief Construct a new constant command table, generating the
+         * perfect hash of the provided commands.
+         * @param entries Array of commands of the table.
+         */
+        constexpr MINBASECLI_CMD_TABLE(
+                const t_cmd_table_entry_cb<CB> (&entries)[N])
+            : entries(entries), slots{}, disp{}
+        {
+            uint32_t hash[N] = {};
+            uint32_t bucket[N] = {};
+            size_t bucket_size[BUCKETS] = {};
+
+            // Get the hash and bucket of each command
+            for (size_t i = 0U; i < N; i++)
+            {
+                if ( (entries[i].command == NULL) ||
+                     (entries[i].command[0] == '\0') ||
+                     (entries[i].callback == NULL) ||
+                     (entries[i].description == NULL) )
+                {   minbasecli_cmd_table_error_invalid_entry();   }
+                for (size_t j = 0U; j < i; j++)
+                {
+                    if (minbasecli_cmd_table_str_equal(entries[i].command,
+                            entries[j].command))
+                    {   minbasecli_cmd_table_error_duplicated_command();   }
+                }
+                hash[i] = minbasecli_cmd_table_hash(entries[i].command);
+                bucket[i] = minbasecli_cmd_table_bucket(hash[i],
+                        BUCKETS - 1U);
+                bucket_size[bucket[i]] = bucket_size[bucket[i]] + 1U;
+            }
+
+            // Place the buckets with more commands first
+            for (size_t size = N; size > 0U; size--)
+            {
+                for (size_t b = 0U; b < BUCKETS; b++)
+                {
+                    if (bucket_size[b] == size)
+                    {   place_bucket(hash, bucket, b);   }
+                }
+            }
+        }
+
+        /**
+         * @brief Get the table information to be used by the CLI lookup.
+         * @return The table information.
+         */
+        constexpr t_cmd_table_cb<CB> info() const
+        {
+            return t_cmd_table_cb<CB>
+            {
+                entries, slots, disp, (uint8_t)(N),
+                (uint16_t)(SLOTS - 1U), (uint16_t)(BUCKETS - 1U)
+            };
+        }
+
+    /*************************************************************************/
+
+    /* Public Attributes */
+
+    public:
+
+        /**
+         * @brief Commands of the table.
+         */
+        const t_cmd_table_entry_cb<CB>* entries;
+
+        /**
+         * @brief Table slots, each one stores the position of a command in
+         * entries plus one (zero means an empty slot).
+         */
+        uint8_t slots[SLOTS];
+
+        /**
+         * @brief Displacement value of each hash bucket.
+         */
+        uint16_t disp[BUCKETS];
+
+    /*************************************************************************/
+
+    /* Private Methods */
+
+    private:
+
+        /**
+         * @brief Search a displacement value that places all commands of a
+         * bucket in free slots, and place them.
+         * @param hash Array of commands hash.
+         * @param bucket Array of commands bucket.
+         * @param b The bucket to place.
+         */
+        constexpr void place_bucket(const uint32_t (&hash)[N],
+                const uint32_t (&bucket)[N], const size_t b)
+        {
+            uint32_t slot = 0U;
+            bool placed = false;
+
+            for (uint32_t d = 0U; d <= MINBASECLI_CMD_TABLE_MAX_DISP; d++)
+            {
+                // Try to place each command of the bucket
+                placed = true;
+                for (size_t i = 0U; i < N; i++)
+                {
+                    if (bucket[i] != b)
+                    {   continue;   }
+                    slot = minbasecli_cmd_table_slot(hash[i], d, SLOTS - 1U);
+                    if (slots[slot] != 0U)
+                    {
+                        placed = false;
+                        break;
+                    }
+                    slots[slot] = (uint8_t)(i + 1U);
+                }
+                if (placed)
+                {
+                    disp[b] = (uint16_t)(d);
+                    return;
+                }
+
+                // Remove the bucket commands placed with this displacement
+                for (size_t s = 0U; s < SLOTS; s++)
+                {
+                    if ( (slots[s] != 0U) && (bucket[slots[s] - 1U] == b) )
+                    {   slots[s] = 0U;   }
+                }
+            }
+
+            minbasecli_cmd_table_error_no_perfect_hash();
+        }
+};
+
+/*****************************************************************************/
+
+/* Table Declaration Helper */
+
+/**
+ * @brief Create a constant command table from an array of commands.
+ * @param entries Array of commands of the table.
+ * @return The constant command table.
+ */
+template <size_t N, typename CB>
+constexpr MINBASECLI_CMD_TABLE<N, CB> minbasecli_cmd_table(
+        const t_cmd_table_entry_cb<CB> (&entries)[N])
+{
+    return MINBASECLI_CMD_TABLE<N, CB>(entries);
+}
+
+#endif /* __cplusplus >= 201402L */
+
+/*****************************************************************************/
+
+#endif /* MINBASECLI_CMD_TABLE_H_ */
@@ -0,0 +1,191 @@
+
+/**
+ * @file    minbasecli_config.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * MINBASECLI configurations. A configuration is a class with the buffers
+ * sizes and limits of a CLI as compile-time constants, so each CLI has just
+ * the buffers that it needs and the compiler can fold its limits. The
+ * default configuration gets its values from the MINBASECLI_MAX_* defines
+ * (minbasecli_hal_select.h), and other ones can be declared through
+ * MINBASECLI_CONFIG:
+ *
+ *   typedef MINBASECLI_CONFIG<32, 16, 64, 4, 32> DEBUG_CLI_CONFIG;
+ *
+ *   MINBASECLI_CFG<DEBUG_CLI_CONFIG> DebugCli;
+ *
+ * Note: This file is included by minbasecli.h.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef MINBASECLI_CONFIG_H_
+#define MINBASECLI_CONFIG_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C/C++ libraries
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Smallest unsigned integer type to store an index (8 bits if the
+ * index values fit in it, 16 bits otherwise).
+ */
+template <bool FITS_8_BITS>
+struct MINBASECLI_INDEX_TYPE
+{   typedef uint16_t type;   };
+
+template <>
+struct MINBASECLI_INDEX_TYPE<true>
+{   typedef uint8_t type;   };
+
+/**
+ * @brief Compile-time boolean type, to select functions implementations
+ * through overloading (tag dispatch).
+ */
+template <bool VALUE>
+struct MINBASECLI_BOOL_TAG
+{};
+
+/*****************************************************************************/
+
+/* Configuration Class */
+
+/**
+ * @brief MINBASECLI_CONFIG Class.
+ * CLI configuration from its buffers sizes and limits.
+ * @param READ_SIZE Read buffer size (maximum command line length).
+ * @param CMD_LEN Maximum command length.
+ * @param TX_SIZE Output (transmission) buffer size.
+ * @param CMD_TO_ADD Maximum number of commands that can be added.
+ * @param CMD_DESCRIPTION Maximum length of commands description texts.
+ * @param TOKENS Maximum number of arguments of a received command line
+ * (MINBASECLI_MAX_TOKENS by default).
+ */
+template <size_t READ_SIZE, size_t CMD_LEN, size_t TX_SIZE,
+        size_t CMD_TO_ADD, size_t CMD_DESCRIPTION,
+        size_t TOKENS = MINBASECLI_MAX_TOKENS>
+struct MINBASECLI_CONFIG
+{
+    static_assert( (READ_SIZE >= 2U) && (READ_SIZE <= 512U),
+            "minbasecli - The read buffer size must be from 2 to 512.");
+    static_assert( (CMD_LEN >= 2U) && (CMD_LEN <= 256U),
+            "minbasecli - The maximum command length must be from 2 to 256 "
+            "(commands lengths and offsets are stored in 8 bits).");
+    static_assert(TX_SIZE >= 1U,
+            "minbasecli - The output buffer size must be 1 or higher.");
+    static_assert(CMD_TO_ADD <= 128U,
+            "minbasecli - The maximum number of commands to add can't be "
+            "higher than 128.");
+    static_assert( (TOKENS >= 1U) && (TOKENS <= 255U),
+            "minbasecli - The maximum number of arguments must be from 1 to "
+            "255 (the number of arguments is stored in 8 bits).");
+
+    /**
+     * @brief Maximum CLI read buffer size.
+     */
+    static const size_t MAX_READ_SIZE = READ_SIZE;
+
+    /**
+     * @brief Maximum CLI command length.
+     */
+    static const size_t MAX_CMD_LEN = CMD_LEN;
+
+    /**
+     * @brief CLI output (transmission) buffer size.
+     */
+    static const size_t MAX_TX_SIZE = TX_SIZE;
+
+    /**
+     * @brief Maximum number of commands that can be added to the CLI.
+     */
+    static const size_t MAX_CMD_TO_ADD = CMD_TO_ADD;
+
+    /**
+     * @brief Maximum length of command description text.
+     */
+    static const size_t MAX_CMD_DESCRIPTION = CMD_DESCRIPTION;
+
+    /**
+     * @brief Maximum number of arguments of a received command line (the
+     * last argument holds the rest of a line with more arguments, and a line
+     * that fits in the read buffer can't have more than half its size).
+     */
+    static const size_t MAX_TOKENS =
+        (TOKENS < (READ_SIZE / 2U)) ? TOKENS : (READ_SIZE / 2U);
+
+    /**
+     * @brief Received command and arguments lengths type (8 bits if the read
+     * buffer size allows it).
+     */
+    typedef typename MINBASECLI_INDEX_TYPE<(READ_SIZE <= 256U)>::type
+            t_word_len;
+
+    /**
+     * @brief Number of slots of the added commands hash index (power of two
+     * and at least twice the maximum number of commands to keep probes
+     * short, or a single unused slot if no command can be added).
+     */
+    static const size_t CMD_HASH_SIZE =
+        (CMD_TO_ADD == 0U) ? 1U :
+        (CMD_TO_ADD <= 8U) ? 16U :
+        (CMD_TO_ADD <= 16U) ? 32U :
+        (CMD_TO_ADD <= 32U) ? 64U :
+        (CMD_TO_ADD <= 64U) ? 128U : 256U;
+
+    /**
+     * @brief Number of nodes of the added commands radix trie (a root node
+     * and two nodes at most for each added command).
+     */
+    static const size_t CMD_TRIE_NODES = (2U * CMD_TO_ADD) + 1U;
+
+    /**
+     * @brief Number of elements of the added commands arrays (at least one,
+     * so the arrays are valid when no command can be added).
+     */
+    static const size_t CMD_SLOTS = (CMD_TO_ADD > 0U) ? CMD_TO_ADD : 1U;
+};
+
+/**
+ * @brief Default CLI configuration (MINBASECLI_MAX_* defines).
+ */
+typedef MINBASECLI_CONFIG<MINBASECLI_MAX_READ_SIZE, MINBASECLI_MAX_CMD_LEN,
+        MINBASECLI_MAX_TX_SIZE, MINBASECLI_MAX_CMD_TO_ADD,
+        MINBASECLI_MAX_CMD_DESCRIPTION, MINBASECLI_MAX_TOKENS>
+        MINBASECLI_DEFAULT_CONFIG;
+
+/*****************************************************************************/
+
+#endif /* MINBASECLI_CONFIG_H_ */
@@ -0,0 +1,400 @@
+
+/**
+ * @file    minbasecli_format.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * MINBASECLI compile-time format strings. A format string declared through
+ * MINBASECLI_FMT() is parsed by the compiler (the same printf() format
+ * specifications, without '*' width or precision), the number and type of
+ * the arguments are checked against its conversions, and the print() call
+ * becomes a sequence of writes of the literal texts and conversions of the
+ * arguments (there is no format parsing at runtime).
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef MINBASECLI_FORMAT_H_
+#define MINBASECLI_FORMAT_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C/C++ libraries
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*****************************************************************************/
+
+/* Constants */
+
+// Format specification flags
+static const uint8_t MINBASECLI_FMT_FLAG_LEFT = 0x01U;
+static const uint8_t MINBASECLI_FMT_FLAG_PLUS = 0x02U;
+static const uint8_t MINBASECLI_FMT_FLAG_SPACE = 0x04U;
+static const uint8_t MINBASECLI_FMT_FLAG_ALT = 0x08U;
+static const uint8_t MINBASECLI_FMT_FLAG_ZERO = 0x10U;
+static const uint8_t MINBASECLI_FMT_FLAG_UPPER = 0x20U;
+
+/**
+ * @brief Compiler check of printf() style format strings and arguments
+ * (member functions, so the implicit object is the first argument).
+ */
+#if defined(__GNUC__)
+    #define MINBASECLI_PRINTF_CHECK(fmt_arg, first_arg) \
+        __attribute__((format(__printf__, fmt_arg, first_arg)))
+#else
+    #define MINBASECLI_PRINTF_CHECK(fmt_arg, first_arg)
+#endif
+
+#if (__cplusplus >= 201402L)
+
+/**
+ * @brief Compile-time format strings support is available.
+ */
+#define MINBASECLI_FORMAT_SUPPORT
+
+// Format string segment steps (what follows the segment literal text)
+static const uint8_t MINBASECLI_FMT_STEP_END = 0U;
+static const uint8_t MINBASECLI_FMT_STEP_LITERAL = 1U;
+static const uint8_t MINBASECLI_FMT_STEP_ARG = 2U;
+
+// Format argument kinds
+static const uint8_t MINBASECLI_FMT_ARG_NONE = 0U;
+static const uint8_t MINBASECLI_FMT_ARG_INTEGER = 1U;
+static const uint8_t MINBASECLI_FMT_ARG_STRING = 2U;
+static const uint8_t MINBASECLI_FMT_ARG_POINTER = 3U;
+static const uint8_t MINBASECLI_FMT_ARG_FLOAT = 4U;
+
+// Format string check results
+static const uint8_t MINBASECLI_FMT_CHECK_OK = 0U;
+static const uint8_t MINBASECLI_FMT_CHECK_INVALID = 1U;
+static const uint8_t MINBASECLI_FMT_CHECK_ARGS_COUNT = 2U;
+static const uint8_t MINBASECLI_FMT_CHECK_ARG_TYPE = 3U;
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// Format string segment: a literal text followed by a conversion, a literal
+// percent symbol or the format string end
+typedef struct t_cli_fmt_conv
+{
+    t_cli_fmt_spec spec;
+    size_t literal;
+    size_t literal_len;
+    size_t next;
+    char conv;
+    uint8_t step;
+    bool valid;
+} t_cli_fmt_conv;
+
+/**
+ * @brief Format argument kind of a type (integers, characters and booleans
+ * are integers; char pointers and arrays are strings; other pointers are
+ * pointers; floating point types are floats; any other type is not
+ * supported).
+ */
+template <typename T>
+struct MINBASECLI_FMT_ARG
+{
+    static constexpr uint8_t KIND = MINBASECLI_FMT_ARG_NONE;
+    static constexpr bool SIGNED = false;
+};
+
+// Integer types
+#define MINBASECLI_FMT_ARG_INT_TYPE(type) \
+    template <> \
+    struct MINBASECLI_FMT_ARG<type> \
+    { \
+        static constexpr uint8_t KIND = MINBASECLI_FMT_ARG_INTEGER; \
+        static constexpr bool SIGNED = ((type)(-1) < (type)(0)); \
+    }
+MINBASECLI_FMT_ARG_INT_TYPE(bool);
+MINBASECLI_FMT_ARG_INT_TYPE(char);
+MINBASECLI_FMT_ARG_INT_TYPE(signed char);
+MINBASECLI_FMT_ARG_INT_TYPE(unsigned char);
+MINBASECLI_FMT_ARG_INT_TYPE(short);
+MINBASECLI_FMT_ARG_INT_TYPE(unsigned short);
+MINBASECLI_FMT_ARG_INT_TYPE(int);
+MINBASECLI_FMT_ARG_INT_TYPE(unsigned int);
+MINBASECLI_FMT_ARG_INT_TYPE(long);
+MINBASECLI_FMT_ARG_INT_TYPE(unsigned long);
+MINBASECLI_FMT_ARG_INT_TYPE(long long);
+MINBASECLI_FMT_ARG_INT_TYPE(unsigned long long);
+#undef MINBASECLI_FMT_ARG_INT_TYPE
+
+// Floating point types
+#define MINBASECLI_FMT_ARG_FLOAT_TYPE(type) \
+    template <> \
+    struct MINBASECLI_FMT_ARG<type> \
+    { \
+        static constexpr uint8_t KIND = MINBASECLI_FMT_ARG_FLOAT; \
+        static constexpr bool SIGNED = true; \
+    }
+MINBASECLI_FMT_ARG_FLOAT_TYPE(float);
+MINBASECLI_FMT_ARG_FLOAT_TYPE(double);
+MINBASECLI_FMT_ARG_FLOAT_TYPE(long double);
+#undef MINBASECLI_FMT_ARG_FLOAT_TYPE
+
+// Pointer types
+template <typename T>
+struct MINBASECLI_FMT_ARG<T*>
+{
+    static constexpr uint8_t KIND = MINBASECLI_FMT_ARG_POINTER;
+    static constexpr bool SIGNED = false;
+};
+
+// String types
+#define MINBASECLI_FMT_ARG_STRING_TYPE(type) \
+    struct MINBASECLI_FMT_ARG<type> \
+    { \
+        static constexpr uint8_t KIND = MINBASECLI_FMT_ARG_STRING; \
+        static constexpr bool SIGNED = false; \
+    }
+template <>
+MINBASECLI_FMT_ARG_STRING_TYPE(char*);
+template <>
+MINBASECLI_FMT_ARG_STRING_TYPE(const char*);
+template <size_t N>
+MINBASECLI_FMT_ARG_STRING_TYPE(char[N]);
+template <size_t N>
+MINBASECLI_FMT_ARG_STRING_TYPE(const char[N]);
+#undef MINBASECLI_FMT_ARG_STRING_TYPE
+
+/**
+ * @brief Format string segment step tag (to select the print() code of
+ * each segment at compile time).
+ */
+template <uint8_t STEP>
+struct MINBASECLI_FMT_STEP {};
+
+/**
+ * @brief Format argument kind tag (to select the print() conversion of each
+ * argument at compile time).
+ */
+template <uint8_t KIND>
+struct MINBASECLI_FMT_KIND {};
+
+/*****************************************************************************/
+
+/* Compile-Time Functions */
+
+/**
+ * @brief Parse the format string segment that starts at a position: its
+ * literal text and the conversion specification that follows it.
+ * @param fstr The format string.
+ * @param pos Position of the segment start.
+ * @return The format string segment.
+ */
+constexpr t_cli_fmt_conv minbasecli_fmt_parse(const char* fstr, size_t pos)
+{
+    t_cli_fmt_conv seg = {};
+
+    seg.spec.precision = -1;
+    seg.literal = pos;
+    seg.valid = true;
+
+    // Get the literal text
+    while ( (fstr[pos] != '\0') && (fstr[pos] != '%') )
+    {   pos = pos + 1U;   }
+    seg.literal_len = pos - seg.literal;
+    if (fstr[pos] == '\0')
+    {
+        seg.next = pos;
+        seg.step = MINBASECLI_FMT_STEP_END;
+        return seg;
+    }
+    pos = pos + 1U;
+
+    // Literal percent symbol (written with the literal text)
+    if (fstr[pos] == '%')
+    {
+        seg.literal_len = seg.literal_len + 1U;
+        seg.next = pos + 1U;
+        seg.step = MINBASECLI_FMT_STEP_LITERAL;
+        return seg;
+    }
+
+    // Get the flags
+    while (true)
+    {
+        if (fstr[pos] == '-')
+        {   seg.spec.flags = seg.spec.flags | MINBASECLI_FMT_FLAG_LEFT;   }
+        else if (fstr[pos] == '+')
+        {   seg.spec.flags = seg.spec.flags | MINBASECLI_FMT_FLAG_PLUS;   }
+        else if (fstr[pos] == ' ')
+        {   seg.spec.flags = seg.spec.flags | MINBASECLI_FMT_FLAG_SPACE;   }
+        else if (fstr[pos] == '#')
+        {   seg.spec.flags = seg.spec.flags | MINBASECLI_FMT_FLAG_ALT;   }
+        else if (fstr[pos] == '0')
+        {   seg.spec.flags = seg.spec.flags | MINBASECLI_FMT_FLAG_ZERO;   }
+        else
+        {   break;   }
+        pos = pos + 1U;
+    }
+
+    // Get the width and precision
+    while ( (fstr[pos] >= '0') && (fstr[pos] <= '9') )
+    {
+        seg.spec.width = (seg.spec.width * 10) + (fstr[pos] - '0');
+        pos = pos + 1U;
+    }
+    if (fstr[pos] == '.')
+    {
+        seg.spec.precision = 0;
+        pos = pos + 1U;
+        while ( (fstr[pos] >= '0') && (fstr[pos] <= '9') )
+        {
+            seg.spec.precision = (seg.spec.precision * 10) + (fstr[pos] - '0');
+            pos = pos + 1U;
+        }
+    }
+
+    // Skip the length modifiers (the argument type is known)
+    while ( (fstr[pos] == 'h') || (fstr[pos] == 'l') || (fstr[pos] == 'z') ||
+            (fstr[pos] == 'j') || (fstr[pos] == 't') || (fstr[pos] == 'L') )
+    {   pos = pos + 1U;   }
+
+    // Get the conversion
+    seg.conv = fstr[pos];
+    seg.step = MINBASECLI_FMT_STEP_ARG;
+    if (seg.conv == '\0')
+    {
+        seg.valid = false;
+        seg.next = pos;
+        return seg;
+    }
+    seg.next = pos + 1U;
+    if ( (seg.conv == 'X') || (seg.conv == 'F') )
+    {   seg.spec.flags = seg.spec.flags | MINBASECLI_FMT_FLAG_UPPER;   }
+    else if (seg.conv == 'p')
+    {   seg.spec.flags = seg.spec.flags | MINBASECLI_FMT_FLAG_ALT;   }
+
+    return seg;
+}
+
+/**
+ * @brief Check if an argument kind can be used by a conversion.
+ * @param conv The conversion character.
+ * @param kind The argument kind.
+ * @return The check result (MINBASECLI_FMT_CHECK_OK, INVALID if the
+ * conversion is not supported, or ARG_TYPE if the kind doesn't match).
+ */
+constexpr uint8_t minbasecli_fmt_check_arg(const char conv,
+        const uint8_t kind)
+{
+    uint8_t expected = MINBASECLI_FMT_ARG_NONE;
+
+    if ( (conv == 'd') || (conv == 'i') || (conv == 'u') || (conv == 'o') ||
+         (conv == 'x') || (conv == 'X') || (conv == 'c') )
+    {   expected = MINBASECLI_FMT_ARG_INTEGER;   }
+    else if (conv == 's')
+    {   expected = MINBASECLI_FMT_ARG_STRING;   }
+    else if (conv == 'p')
+    {
+        expected = MINBASECLI_FMT_ARG_POINTER;
+        if (kind == MINBASECLI_FMT_ARG_STRING)
+        {   expected = MINBASECLI_FMT_ARG_STRING;   }
+    }
+    else if ( (conv == 'f') || (conv == 'F') )
+    {   expected = MINBASECLI_FMT_ARG_FLOAT;   }
+    else
+    {   return MINBASECLI_FMT_CHECK_INVALID;   }
+
+    if (kind != expected)
+    {   return MINBASECLI_FMT_CHECK_ARG_TYPE;   }
+
+    return MINBASECLI_FMT_CHECK_OK;
+}
+
+/**
+ * @brief Check a format string against the types of its arguments.
+ * @param fstr The format string.
+ * @return The check result (MINBASECLI_FMT_CHECK_OK, INVALID, ARGS_COUNT
+ * or ARG_TYPE).
+ */
+template <typename... ARGS>
+constexpr uint8_t minbasecli_fmt_check(const char* fstr)
+{
+    const uint8_t kinds[] = { MINBASECLI_FMT_ARG<ARGS>::KIND...,
+            MINBASECLI_FMT_ARG_NONE };
+    t_cli_fmt_conv seg = {};
+    size_t pos = 0U;
+    size_t arg = 0U;
+    uint8_t result = MINBASECLI_FMT_CHECK_OK;
+
+    while (true)
+    {
+        seg = minbasecli_fmt_parse(fstr, pos);
+        if (!seg.valid)
+        {   return MINBASECLI_FMT_CHECK_INVALID;   }
+        if (seg.step == MINBASECLI_FMT_STEP_END)
+        {   break;   }
+        if (seg.step == MINBASECLI_FMT_STEP_ARG)
+        {
+            if (arg >= sizeof...(ARGS))
+            {   return MINBASECLI_FMT_CHECK_ARGS_COUNT;   }
+            result = minbasecli_fmt_check_arg(seg.conv, kinds[arg]);
+            if (result != MINBASECLI_FMT_CHECK_OK)
+            {   return result;   }
+            arg = arg + 1U;
+        }
+        pos = seg.next;
+    }
+    if (arg != sizeof...(ARGS))
+    {   return MINBASECLI_FMT_CHECK_ARGS_COUNT;   }
+
+    return MINBASECLI_FMT_CHECK_OK;
+}
+
+/*****************************************************************************/
+
+/* Format String Declaration Helper */
+
+/**
+ * @brief Declare a compile-time format string to be used by print(). It
+ * creates an object of a unique type that carries the string literal.
+ * @param fstr The format string literal.
+ */
+#define MINBASECLI_FMT(fstr) \
+    ([]() \
+    { \
+        struct t_cli_fmt_str \
+        { \
+            static constexpr const char* str() \
+            {   return fstr;   } \
+        }; \
+        return t_cli_fmt_str(); \
+    }())
+
+#endif /* __cplusplus >= 201402L */
+
+/*****************************************************************************/
+
+#endif /* MINBASECLI_FORMAT_H_ */
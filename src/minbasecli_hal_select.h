@@ -41,9 +41,15 @@
 
 #if defined(__linux__)
 
-    // Interface HAL Selection
-    #include "hal/linux/minbasecli_linux.h"
-    #define MINBASECLI_HAL MINBASECLI_LINUX
+    // Interface HAL Selection (event-driven HAL without read thread if
+    // MINBASECLI_HAL_LINUX_POLL is defined)
+    #if defined(MINBASECLI_HAL_LINUX_POLL)
+        #include "hal/linux/minbasecli_linux_poll.h"
+        #define MINBASECLI_HAL MINBASECLI_LINUX_POLL
+    #else
+        #include "hal/linux/minbasecli_linux.h"
+        #define MINBASECLI_HAL MINBASECLI_LINUX
+    #endif
 
     // Default CLI Interface to use if not provided
     #if !defined(MINBASECLI_DEFAULT_IFACE)
@@ -65,19 +71,14 @@
         #define MINBASECLI_MAX_CMD_LEN 64
     #endif
 
-    // Maximum CLI Command Argument length
-    #if !defined(MINBASECLI_MAX_ARGV_LEN)
-        #define MINBASECLI_MAX_ARGV_LEN 32
-    #endif
-
-    // Maximum number of arguments to check on a received CLI command
-    #if !defined(MINBASECLI_MAX_ARGV)
-        #define MINBASECLI_MAX_ARGV 8
-    #endif
-
     // Maximum Print formatted number array size
     #if !defined(MINBASECLI_MAX_PRINT_SIZE)
-        #define MINBASECLI_MAX_PRINT_SIZE 22
+        #define MINBASECLI_MAX_PRINT_SIZE 23
+    #endif
+
+    // CLI output (transmission) buffer size
+    #if !defined(MINBASECLI_MAX_TX_SIZE)
+        #define MINBASECLI_MAX_TX_SIZE 256
     #endif
 
     // Maximum number of commands that can be added to the CLI
@@ -90,6 +91,17 @@
         #define MINBASECLI_MAX_CMD_DESCRIPTION 128
     #endif
 
+    // Maximum number of arguments (words after the command) of a received
+    // command line
+    #if !defined(MINBASECLI_MAX_TOKENS)
+        #define MINBASECLI_MAX_TOKENS 32
+    #endif
+
+    // Read chunk size to stream script files (see run_fd())
+    #if !defined(MINBASECLI_SCRIPT_CHUNK_SIZE)
+        #define MINBASECLI_SCRIPT_CHUNK_SIZE 16384
+    #endif
+
 /*****************************************************************************/
 
 /* Hardware Abstraction Layer: Windows */
@@ -120,19 +132,14 @@
         #define MINBASECLI_MAX_CMD_LEN 64
     #endif
 
-    // Maximum CLI Command Argument length
-    #if !defined(MINBASECLI_MAX_ARGV_LEN)
-        #define MINBASECLI_MAX_ARGV_LEN 32
-    #endif
-
-    // Maximum number of arguments to check on a received CLI command
-    #if !defined(MINBASECLI_MAX_ARGV)
-        #define MINBASECLI_MAX_ARGV 8
-    #endif
-
     // Maximum Print formatted number array size
     #if !defined(MINBASECLI_MAX_PRINT_SIZE)
-        #define MINBASECLI_MAX_PRINT_SIZE 22
+        #define MINBASECLI_MAX_PRINT_SIZE 23
+    #endif
+
+    // CLI output (transmission) buffer size
+    #if !defined(MINBASECLI_MAX_TX_SIZE)
+        #define MINBASECLI_MAX_TX_SIZE 256
     #endif
 
     // Maximum number of commands that can be added to the CLI
@@ -145,6 +152,12 @@
         #define MINBASECLI_MAX_CMD_DESCRIPTION 128
     #endif
 
+    // Maximum number of arguments (words after the command) of a received
+    // command line
+    #if !defined(MINBASECLI_MAX_TOKENS)
+        #define MINBASECLI_MAX_TOKENS 32
+    #endif
+
 /*****************************************************************************/
 
 /* Hardware Abstraction Layer: Arduino */
@@ -183,19 +196,14 @@
             #define MINBASECLI_MAX_CMD_LEN 16
         #endif
 
-        // Maximum CLI Command Argument length
-        #if !defined(MINBASECLI_MAX_ARGV_LEN)
-            #define MINBASECLI_MAX_ARGV_LEN 12
-        #endif
-
-        // Maximum number of arguments to check on a received CLI command
-        #if !defined(MINBASECLI_MAX_ARGV)
-            #define MINBASECLI_MAX_ARGV 2
-        #endif
-
         // Maximum Print formatted number array size
         #if !defined(MINBASECLI_MAX_PRINT_SIZE)
-            #define MINBASECLI_MAX_PRINT_SIZE 22
+            #define MINBASECLI_MAX_PRINT_SIZE 23
+        #endif
+
+        // CLI output (transmission) buffer size
+        #if !defined(MINBASECLI_MAX_TX_SIZE)
+            #define MINBASECLI_MAX_TX_SIZE 32
         #endif
 
         // Maximum number of commands that can be added to the CLI
@@ -208,6 +216,12 @@
             #define MINBASECLI_MAX_CMD_DESCRIPTION 32
         #endif
 
+        // Maximum number of arguments (words after the command) of a received
+        // command line
+        #if !defined(MINBASECLI_MAX_TOKENS)
+            #define MINBASECLI_MAX_TOKENS 8
+        #endif
+
     #else // ARM, SAM, SAMD, STM32, ESP32, ESP8266, etc.
 
         // Default CLI Baud Rate Speed to use if not provided
@@ -225,19 +239,14 @@
             #define MINBASECLI_MAX_CMD_LEN 24
         #endif
 
-        // Maximum CLI Command Argument length
-        #if !defined(MINBASECLI_MAX_ARGV_LEN)
-            #define MINBASECLI_MAX_ARGV_LEN 32
-        #endif
-
-        // Maximum number of arguments to check on a received CLI command
-        #if !defined(MINBASECLI_MAX_ARGV)
-            #define MINBASECLI_MAX_ARGV 4
-        #endif
-
         // Maximum Print formatted number array size
         #if !defined(MINBASECLI_MAX_PRINT_SIZE)
-            #define MINBASECLI_MAX_PRINT_SIZE 22
+            #define MINBASECLI_MAX_PRINT_SIZE 23
+        #endif
+
+        // CLI output (transmission) buffer size
+        #if !defined(MINBASECLI_MAX_TX_SIZE)
+            #define MINBASECLI_MAX_TX_SIZE 64
         #endif
 
         // Maximum number of commands that can be added to the CLI
@@ -250,6 +259,12 @@
             #define MINBASECLI_MAX_CMD_DESCRIPTION 64
         #endif
 
+        // Maximum number of arguments (words after the command) of a received
+        // command line
+        #if !defined(MINBASECLI_MAX_TOKENS)
+            #define MINBASECLI_MAX_TOKENS 16
+        #endif
+
     #endif
 
 /*****************************************************************************/
@@ -282,19 +297,14 @@
         #define MINBASECLI_MAX_CMD_LEN 16
     #endif
 
-    // Maximum CLI Command Argument length
-    #if !defined(MINBASECLI_MAX_ARGV_LEN)
-        #define MINBASECLI_MAX_ARGV_LEN 12
-    #endif
-
-    // Maximum number of arguments to check on a received CLI command
-    #if !defined(MINBASECLI_MAX_ARGV)
-        #define MINBASECLI_MAX_ARGV 2
-    #endif
-
     // Maximum Print formatted number array size
     #if !defined(MINBASECLI_MAX_PRINT_SIZE)
-        #define MINBASECLI_MAX_PRINT_SIZE 22
+        #define MINBASECLI_MAX_PRINT_SIZE 23
+    #endif
+
+    // CLI output (transmission) buffer size
+    #if !defined(MINBASECLI_MAX_TX_SIZE)
+        #define MINBASECLI_MAX_TX_SIZE 32
     #endif
 
     // Maximum number of commands that can be added to the CLI
@@ -307,6 +317,12 @@
         #define MINBASECLI_MAX_CMD_DESCRIPTION 32
     #endif
 
+    // Maximum number of arguments (words after the command) of a received
+    // command line
+    #if !defined(MINBASECLI_MAX_TOKENS)
+        #define MINBASECLI_MAX_TOKENS 8
+    #endif
+
 /*****************************************************************************/
 
 /* Hardware Abstraction Layer: ESP-IDF */
@@ -337,19 +353,14 @@
         #define MINBASECLI_MAX_CMD_LEN 24
     #endif
 
-    // Maximum CLI Command Argument length
-    #if !defined(MINBASECLI_MAX_ARGV_LEN)
-        #define MINBASECLI_MAX_ARGV_LEN 32
-    #endif
-
-    // Maximum number of arguments to check on a received CLI command
-    #if !defined(MINBASECLI_MAX_ARGV)
-        #define MINBASECLI_MAX_ARGV 4
-    #endif
-
     // Maximum Print formatted number array size
     #if !defined(MINBASECLI_MAX_PRINT_SIZE)
-        #define MINBASECLI_MAX_PRINT_SIZE 22
+        #define MINBASECLI_MAX_PRINT_SIZE 23
+    #endif
+
+    // CLI output (transmission) buffer size
+    #if !defined(MINBASECLI_MAX_TX_SIZE)
+        #define MINBASECLI_MAX_TX_SIZE 128
     #endif
 
     // Maximum number of commands that can be added to the CLI
@@ -362,6 +373,12 @@
         #define MINBASECLI_MAX_CMD_DESCRIPTION 64
     #endif
 
+    // Maximum number of arguments (words after the command) of a received
+    // command line
+    #if !defined(MINBASECLI_MAX_TOKENS)
+        #define MINBASECLI_MAX_TOKENS 16
+    #endif
+
 /*****************************************************************************/
 
 /* Hardware Abstraction Layer: STM32 */
@@ -397,19 +414,14 @@
         #define MINBASECLI_MAX_CMD_LEN 24
     #endif
 
-    // Maximum CLI Command Argument length
-    #if !defined(MINBASECLI_MAX_ARGV_LEN)
-        #define MINBASECLI_MAX_ARGV_LEN 32
-    #endif
-
-    // Maximum number of arguments to check on a received CLI command
-    #if !defined(MINBASECLI_MAX_ARGV)
-        #define MINBASECLI_MAX_ARGV 4
-    #endif
-
     // Maximum Print formatted number array size
     #if !defined(MINBASECLI_MAX_PRINT_SIZE)
-        #define MINBASECLI_MAX_PRINT_SIZE 22
+        #define MINBASECLI_MAX_PRINT_SIZE 23
+    #endif
+
+    // CLI output (transmission) buffer size
+    #if !defined(MINBASECLI_MAX_TX_SIZE)
+        #define MINBASECLI_MAX_TX_SIZE 64
     #endif
 
     // Maximum number of commands that can be added to the CLI
@@ -422,6 +434,12 @@
         #define MINBASECLI_MAX_CMD_DESCRIPTION 64
     #endif
 
+    // Maximum number of arguments (words after the command) of a received
+    // command line
+    #if !defined(MINBASECLI_MAX_TOKENS)
+        #define MINBASECLI_MAX_TOKENS 16
+    #endif
+
 /*****************************************************************************/
 
 /* Hardware Abstraction Layer: None */
@@ -454,19 +472,14 @@
         #define MINBASECLI_MAX_CMD_LEN 24
     #endif
 
-    // Maximum CLI Command Argument length
-    #if !defined(MINBASECLI_MAX_ARGV_LEN)
-        #define MINBASECLI_MAX_ARGV_LEN 32
-    #endif
-
-    // Maximum number of arguments to check on a received CLI command
-    #if !defined(MINBASECLI_MAX_ARGV)
-        #define MINBASECLI_MAX_ARGV 4
-    #endif
-
     // Maximum Print formatted number array size
     #if !defined(MINBASECLI_MAX_PRINT_SIZE)
-        #define MINBASECLI_MAX_PRINT_SIZE 22
+        #define MINBASECLI_MAX_PRINT_SIZE 23
+    #endif
+
+    // CLI output (transmission) buffer size
+    #if !defined(MINBASECLI_MAX_TX_SIZE)
+        #define MINBASECLI_MAX_TX_SIZE 64
     #endif
 
     // Maximum number of commands that can be added to the CLI
@@ -479,6 +492,41 @@
         #define MINBASECLI_MAX_CMD_DESCRIPTION 64
     #endif
 
+    // Maximum number of arguments (words after the command) of a received
+    // command line
+    #if !defined(MINBASECLI_MAX_TOKENS)
+        #define MINBASECLI_MAX_TOKENS 16
+    #endif
+
+#endif
+
+/*****************************************************************************/
+
+/* Hardware Abstraction Layer: Loopback */
+
+// The default CLI (MINBASECLI) can use the in-memory loopback HAL (input and
+// output buffers with virtual time, for tests and benchmarks) instead of the
+// device/framework one, defining MINBASECLI_HAL_LOOPBACK in the build flags.
+// The configuration values of the device/framework are kept.
+#if defined(MINBASECLI_HAL_LOOPBACK)
+    #include "hal/loopback/minbasecli_loopback.h"
+    #undef MINBASECLI_HAL
+    #define MINBASECLI_HAL MINBASECLI_LOOPBACK
+#endif
+
+/*****************************************************************************/
+
+/* Hardware Abstraction Layer: Custom */
+
+// The default CLI (MINBASECLI) can use a custom HAL class instead of the
+// device/framework one, without editing this file, defining the class name
+// (MINBASECLI_CUSTOM_HAL) and its header file (MINBASECLI_CUSTOM_HAL_HEADER)
+// in the build flags. The configuration values of the device/framework are
+// kept. Other CLIs can use any HAL class through MINBASECLI_CORE<HAL>.
+#if defined(MINBASECLI_CUSTOM_HAL)
+    #include MINBASECLI_CUSTOM_HAL_HEADER
+    #undef MINBASECLI_HAL
+    #define MINBASECLI_HAL MINBASECLI_CUSTOM_HAL
 #endif
 
 /*****************************************************************************/
@@ -0,0 +1,3502 @@
+
+/**
+ * @file    minbasecli_impl.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * A simple Command Line Interface C++ library implementation with HAL
+ * emphasis to be used in different kind of devices and frameworks.
+ *
+ * This file implements the MINBASECLI_CORE class template methods. The
+ * default CLI (MINBASECLI) is compiled once in minbasecli.cpp, so this file
+ * just needs to be included to use the CLI core over other HAL class (i.e.
+ * a custom interface), that provides the same hal_*() methods than the HALs
+ * of the hal directory, or with other configuration (see
+ * minbasecli_config.h):
+ *
+ *   #include "minbasecli.h"
+ *   #include "minbasecli_impl.h"
+ *
+ *   MINBASECLI_CORE<MY_HAL> Cli;
+ *   MINBASECLI_CFG< MINBASECLI_CONFIG<32, 16, 64, 4, 32> > DebugCli;
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2021 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef MINBASECLI_IMPL_H_
+#define MINBASECLI_IMPL_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "minbasecli.h"
+
+// Integer to text conversion kernels
+#include "minbasecli_itoa.h"
+
+// Standard Libraries
+#include <string.h>
+#include <stdarg.h>
+
+// Script files execution
+#if defined(MINBASECLI_SCRIPT_FILE)
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// Floating point printf() conversions
+#if defined(MINBASECLI_PRINTF_FLOAT)
+    #include <math.h>
+#endif
+
+/*****************************************************************************/
+
+/* Constants & Defines */
+
+// printf() format length modifiers
+static const uint8_t FMT_LEN_NONE = 0U;
+static const uint8_t FMT_LEN_HH = 1U;
+static const uint8_t FMT_LEN_H = 2U;
+static const uint8_t FMT_LEN_L = 3U;
+static const uint8_t FMT_LEN_LL = 4U;
+static const uint8_t FMT_LEN_Z = 5U;
+static const uint8_t FMT_LEN_J = 6U;
+static const uint8_t FMT_LEN_T = 7U;
+static const uint8_t FMT_LEN_LD = 8U;
+
+// Maximum wait for received data while there is output pending to be sent
+// with a non-blocking output policy (milliseconds)
+static const uint32_t TX_PENDING_WAIT_MS = 1U;
+
+#if defined(MINBASECLI_CMD_ASYNC)
+
+// Asynchronous commands executions states
+static const uint8_t ASYNC_JOB_FREE = 0U;
+static const uint8_t ASYNC_JOB_QUEUED = 1U;
+static const uint8_t ASYNC_JOB_RUNNING = 2U;
+static const uint8_t ASYNC_JOB_DONE = 3U;
+
+// Maximum wait for received data while there are asynchronous commands
+// running, to send their responses when they end (milliseconds)
+static const uint32_t ASYNC_PENDING_WAIT_MS = 5U;
+
+#endif
+
+// printf() padding characters block size
+static const size_t FMT_PAD_BLOCK_SIZE = 8U;
+
+// printf() floating point default precision and maximum number of computed
+// decimals (the next ones are written as zeros)
+static const int FMT_FLOAT_DEFAULT_PRECISION = 6;
+static const int FMT_FLOAT_MAX_DIGITS = 9;
+
+// printf() floating point split factor to get exact products (2^27 + 1)
+static const double FMT_FLOAT_SPLIT = 134217729.0;
+
+// Empty string for commands results without command
+static char EMPTY_STR[] = "";
+
+// FNV-1a 32 bits hash offset basis and prime
+static const uint32_t FNV1A_32_OFFSET_BASIS = 2166136261UL;
+static const uint32_t FNV1A_32_PRIME = 16777619UL;
+
+#if defined(MINBASECLI_LOG_DEFERRED)
+
+// Deferred log format strings section start and end (defined by the
+// linker) and an empty entry that makes the section exist if no
+// MINBASECLI_LOG() is used
+extern const char __start_minbasecli_log[];
+extern const char __stop_minbasecli_log[];
+static const char LOG_SECTION_ANCHOR[]
+    __attribute__((section("minbasecli_log"), used)) = "";
+
+// Deferred log format strings section maximum size (the format strings IDs
+// are 16 bits offsets from the section start)
+static const size_t LOG_SECTION_MAX_SIZE = 65536U;
+
+#endif
+
+/*****************************************************************************/
+
+/* Static Attributes */
+
+#if defined(MINBASECLI_CMD_ASYNC)
+
+template <class HAL, class CFG>
+thread_local typename MINBASECLI_CORE<HAL, CFG>::t_async_job*
+        MINBASECLI_CORE<HAL, CFG>::async_job = NULL;
+
+#endif
+
+/*****************************************************************************/
+
+/* Constructor */
+
+/**
+ * @details
+ * This constructor initializes all attributes of the CLI class.
+ */
+template <class HAL, class CFG>
+MINBASECLI_CORE<HAL, CFG>::MINBASECLI_CORE()
+{
+    this->initialized = false;
+    this->received_bytes = 0;
+    this->use_builtin_help_cmd = false;
+#if defined(MINBASECLI_CMD_STATS)
+    this->use_builtin_stats_cmd = false;
+#endif
+    this->num_added_commands = 0;
+    set_default_result(&(this->cli_result));
+    for (size_t i = 0; i < CFG::MAX_CMD_TO_ADD; i++)
+    {
+#if defined(MINBASECLI_CMD_ZERO_COPY)
+        this->added_commands[i].command = NULL;
+        this->added_commands[i].description = NULL;
+#else
+        this->added_commands[i].command[0] = '\0';
+        this->added_commands[i].description[0] = '\0';
+#endif
+        this->added_commands[i].callback = NULL;
+        this->added_commands[i].hash = 0U;
+        this->added_commands[i].description_len = 0U;
+        this->added_commands[i].command_len = 0U;
+#if defined(MINBASECLI_CMD_PROGMEM)
+        this->added_commands[i].progmem = false;
+#endif
+#if defined(MINBASECLI_CMD_STATS)
+        memset(&(this->added_commands[i].stats), 0,
+                sizeof(this->added_commands[i].stats));
+#endif
+#if defined(MINBASECLI_CMD_ASYNC)
+        this->added_commands[i].async = false;
+#endif
+    }
+    memset(this->cmd_hash_index, 0, CFG::CMD_HASH_SIZE);
+#if defined(MINBASECLI_CMD_TRIE)
+    memset(this->cmd_trie, 0, sizeof(this->cmd_trie));
+    this->cmd_trie_num_nodes = 1U;
+    this->cmd_trie_multiword = false;
+#endif
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+    memset(&(this->cmd_table), 0, sizeof(this->cmd_table));
+#endif
+    memset(this->rx_read, (int)('\0'), CFG::MAX_READ_SIZE - 1U);
+    this->rx_read_len = 0U;
+    this->rx_line_next = 0U;
+    this->rx_skip_lf = false;
+    memset(this->print_array, (int)('\0'), MINBASECLI_MAX_PRINT_SIZE - 1U);
+    this->tx_buffer_len = 0U;
+    this->tx_buffer_tail = 0U;
+    this->tx_policy = MINBASECLI_TX_POLICY;
+    this->tx_truncating = false;
+    this->tx_dropped = 0U;
+    this->tx_truncated = 0U;
+    this->tx_line_flush = true;
+#if defined(MINBASECLI_CMD_ASYNC)
+    for (size_t i = 0; i < MINBASECLI_ASYNC_JOBS; i++)
+    {   this->async_jobs[i].state = ASYNC_JOB_FREE;   }
+    pthread_mutex_init(&(this->async_mutex), NULL);
+    pthread_cond_init(&(this->async_cond), NULL);
+    this->async_num_workers = 0U;
+    this->async_stop = false;
+    this->async_order = MINBASECLI_ASYNC_ORDER_COMPLETION;
+    this->async_next_tag = 1U;
+    this->async_next_done_seq = 0U;
+#endif
+}
+
+#if defined(MINBASECLI_CMD_ASYNC)
+/**
+ * @details
+ * This destructor stops the worker threads and releases the asynchronous
+ * commands lock and condition.
+ */
+template <class HAL, class CFG>
+MINBASECLI_CORE<HAL, CFG>::~MINBASECLI_CORE()
+{
+    stop_async();
+    pthread_cond_destroy(&(this->async_cond));
+    pthread_mutex_destroy(&(this->async_mutex));
+}
+#endif
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details
+ * This function call to specific Hardware Abstraction Layer CLI interface
+ * setup function to initialize the interface, and set the CLI initialized
+ * flag. With deferred logging, the log section size is checked before, as
+ * the records would get wrong format strings IDs past 64 KiB.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::setup(void* iface, const uint32_t baud_rate)
+{
+#if defined(MINBASECLI_LOG_DEFERRED)
+    // Check that every format string offset fits in its 16 bits ID
+    if ( (size_t)(__stop_minbasecli_log - __start_minbasecli_log) >
+         LOG_SECTION_MAX_SIZE )
+    {   return false;   }
+#endif
+
+    if (this->hal_setup(iface, baud_rate) == true)
+    {   this->initialized = true;   }
+    return this->initialized;
+}
+
+/**
+ * @details
+ * This function check if provided arguments are valid, creates a new command
+ * callback element according to provided arguments and add it to the list
+ * of added commands. The command and description texts are copied into the
+ * element, or just referenced in zero-copy mode (MINBASECLI_CMD_ZERO_COPY),
+ * and their lengths are computed here to not need it anymore.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::add_cmd(const char* command,
+        t_callback callback, const char* description)
+{
+    t_cmd_cb_info cmd_cb_info;
+    size_t cmd_len = 0U;
+    size_t cmd_description_len = 0U;
+
+    // Check if provided argument are valid
+    if ( (command == NULL) || (callback == NULL) || (description == NULL) )
+    {   return false;   }
+
+    // Get provided arguments lengths
+    cmd_len = strlen(command);
+    cmd_description_len = strlen(description);
+
+#if defined(MINBASECLI_CMD_ZERO_COPY)
+    // Check provided arguments lengths (a command that doesn't fit in the
+    // received command buffer could never be matched)
+    if (cmd_len >= CFG::MAX_CMD_LEN)
+    {   return false;   }
+    if (cmd_description_len > UINT16_MAX)
+    {   cmd_description_len = UINT16_MAX;   }
+
+    // Create a new t_cmd_cb_info element referencing provided command data
+    cmd_cb_info.command = command;
+    cmd_cb_info.description = description;
+#else
+    // Limit provided arguments lengths
+    if (cmd_len >= CFG::MAX_CMD_LEN)
+    {   cmd_len = CFG::MAX_CMD_LEN - 1U;   }
+    if (cmd_description_len >= CFG::MAX_CMD_DESCRIPTION)
+    {   cmd_description_len = CFG::MAX_CMD_DESCRIPTION - 1U;   }
+
+    // Create a new t_cmd_cb_info element with provided command data
+    memcpy(cmd_cb_info.command, command, cmd_len);
+    cmd_cb_info.command[cmd_len] = '\0';
+    memcpy(cmd_cb_info.description, description, cmd_description_len);
+    cmd_cb_info.description[cmd_description_len] = '\0';
+#endif
+    cmd_cb_info.callback = callback;
+    cmd_cb_info.command_len = (uint8_t)(cmd_len);
+    cmd_cb_info.description_len = (uint16_t)(cmd_description_len);
+    cmd_cb_info.hash = cmd_hash(cmd_cb_info.command, &cmd_len);
+#if defined(MINBASECLI_CMD_PROGMEM)
+    cmd_cb_info.progmem = false;
+#endif
+#if defined(MINBASECLI_CMD_ASYNC)
+    cmd_cb_info.async = false;
+#endif
+
+    return cmd_register(&cmd_cb_info, cmd_cb_info.command);
+}
+
+#if defined(MINBASECLI_CMD_PROGMEM)
+
+/**
+ * @details
+ * This function check if provided arguments are valid and creates a new
+ * command callback element that references the provided program memory
+ * strings, computing the command hash and texts lengths from the program
+ * memory, and add it to the list of added commands.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::add_cmd_P(PGM_P command, t_callback callback,
+        PGM_P description)
+{
+    t_cmd_cb_info cmd_cb_info;
+    char cmd[CFG::MAX_CMD_LEN];
+    size_t cmd_len = 0U;
+    size_t cmd_description_len = 0U;
+
+    // Check if provided argument are valid
+    if ( (command == NULL) || (callback == NULL) || (description == NULL) )
+    {   return false;   }
+
+    // Get and check provided arguments lengths
+    cmd_len = strlen_P(command);
+    cmd_description_len = strlen_P(description);
+    if (cmd_len >= CFG::MAX_CMD_LEN)
+    {   return false;   }
+    if (cmd_description_len > UINT16_MAX)
+    {   cmd_description_len = UINT16_MAX;   }
+
+    // Get a RAM copy of the command text to get its hash and check it
+    strcpy_P(cmd, command);
+
+    // Create a new t_cmd_cb_info element referencing provided command data
+    cmd_cb_info.command = command;
+    cmd_cb_info.description = description;
+    cmd_cb_info.callback = callback;
+    cmd_cb_info.command_len = (uint8_t)(cmd_len);
+    cmd_cb_info.description_len = (uint16_t)(cmd_description_len);
+    cmd_cb_info.hash = cmd_hash(cmd, &cmd_len);
+    cmd_cb_info.progmem = true;
+#if defined(MINBASECLI_CMD_ASYNC)
+    cmd_cb_info.async = false;
+#endif
+
+    return cmd_register(&cmd_cb_info, cmd);
+}
+
+#endif
+
+#if defined(MINBASECLI_CMD_ASYNC)
+
+/**
+ * @details
+ * This function adds the command through add_cmd() and marks it as
+ * asynchronous, and then creates the worker threads (they wait for queued
+ * commands until stop_async() is called) if they are not running. If any
+ * worker thread can't be created, the already created ones are stopped and
+ * the command is kept as a synchronous one.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::add_cmd_async(const char* command,
+        t_callback callback, const char* description)
+{
+    t_cmd_cb_info* cmd_cb_info = NULL;
+
+    if (add_cmd(command, callback, description) == false)
+    {   return false;   }
+    cmd_cb_info = &(added_commands[num_added_commands - 1U]);
+
+    // Create the worker threads
+    if (async_num_workers == 0U)
+    {
+        for (uint8_t i = 0U; i < MINBASECLI_ASYNC_WORKERS; i++)
+        {
+            if (pthread_create(&(async_workers[i]), NULL,
+                    async_worker_thread, this) != 0)
+            {
+                stop_async();
+                return false;
+            }
+            async_num_workers = async_num_workers + 1U;
+        }
+    }
+    cmd_cb_info->async = true;
+
+    return true;
+}
+
+/**
+ * @details
+ * This function checks and sets the asynchronous commands responses order
+ * (the order of the responses already pending is also changed).
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::set_async_order(const uint8_t order)
+{
+    if (order > MINBASECLI_ASYNC_ORDER_SUBMISSION)
+    {   return false;   }
+    async_order = order;
+    return true;
+}
+
+/**
+ * @details
+ * This function counts the asynchronous commands executions in use.
+ */
+template <class HAL, class CFG>
+uint8_t MINBASECLI_CORE<HAL, CFG>::get_async_pending()
+{
+    uint8_t pending = 0U;
+
+    pthread_mutex_lock(&async_mutex);
+    for (size_t i = 0U; i < MINBASECLI_ASYNC_JOBS; i++)
+    {
+        if (async_jobs[i].state != ASYNC_JOB_FREE)
+        {   pending = pending + 1U;   }
+    }
+    pthread_mutex_unlock(&async_mutex);
+
+    return pending;
+}
+
+/**
+ * @details
+ * This function drops the queued commands executions (so they are not
+ * executed by a later pool), requests the worker threads to stop, wakes them
+ * up and waits for them to end (a running command ends before its worker
+ * checks the request, and its response is kept to be sent).
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::stop_async()
+{
+    pthread_mutex_lock(&async_mutex);
+    for (size_t i = 0U; i < MINBASECLI_ASYNC_JOBS; i++)
+    {
+        if (async_jobs[i].state == ASYNC_JOB_QUEUED)
+        {   async_jobs[i].state = ASYNC_JOB_FREE;   }
+    }
+    async_stop = true;
+    pthread_cond_broadcast(&async_cond);
+    pthread_mutex_unlock(&async_mutex);
+
+    for (uint8_t i = 0U; i < async_num_workers; i++)
+    {   pthread_join(async_workers[i], NULL);   }
+    async_num_workers = 0U;
+    async_stop = false;
+}
+
+#endif
+
+/**
+ * @details
+ * This function checks if there is enough space in the added commands array
+ * to store a new command callback info and if the command has not already
+ * been added, and add it to the list of added commands. The command is also
+ * inserted in the hash index (linear probing) and in the commands trie, while
+ * the list keeps the registration order for the help output.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::cmd_register(const t_cmd_cb_info* cmd_cb_info,
+        const char* command)
+{
+    // Check if there is enough space to add a new command (none can be
+    // added if the configuration has no added commands)
+    if (num_added_commands >= CFG::MAX_CMD_TO_ADD)
+    {   return false;   }
+
+    // Check if the command has already been added
+    if (cmd_find(command, cmd_cb_info->command_len, cmd_cb_info->hash) != NULL)
+    {   return false;   }
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+    if (cmd_table_find(command, cmd_cb_info->hash) != NULL)
+    {   return false;   }
+#endif
+
+    // Set to use the internal "help" command if it is the first command added
+    if (any_cmd() == false)
+    {
+        use_builtin_help_cmd = true;
+#if defined(MINBASECLI_CMD_STATS)
+        use_builtin_stats_cmd = true;
+#endif
+    }
+
+    // If requested to add a custom "help" command, don't use the builtin one
+    if (strcmp(command, CMD_HELP) == 0)
+    {   use_builtin_help_cmd = false;   }
+#if defined(MINBASECLI_CMD_STATS)
+    if (strcmp(command, CMD_STATS) == 0)
+    {   use_builtin_stats_cmd = false;   }
+#endif
+
+    // Add the new command to the list of binded commands and increase the
+    // number of added commands
+    added_commands[num_added_commands] = *cmd_cb_info;
+#if defined(MINBASECLI_CMD_STATS)
+    memset(&(added_commands[num_added_commands].stats), 0,
+            sizeof(added_commands[num_added_commands].stats));
+#endif
+    num_added_commands = num_added_commands + 1U;
+
+    // Insert the command in the hash index and in the commands trie
+    cmd_index_insert(num_added_commands - 1U, command, t_cmd_index_tag());
+
+    return true;
+}
+
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+
+/**
+ * @details
+ * This function checks that none of the constant table commands has already
+ * been added through add_cmd(), and stores the table information to be used
+ * in the commands lookup. The builtin "help" command is used unless the table
+ * or the added commands provide a custom one.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::set_cmd_table(
+        const t_cmd_table_cb<t_callback>& table)
+{
+    const char* command = NULL;
+    size_t command_len = 0U;
+    uint32_t hash = 0U;
+
+    // Check for commands of the table that have already been added
+    for (uint8_t i = 0U; i < table.num_entries; i++)
+    {
+        command = table.entries[i].command;
+        hash = cmd_hash(command, &command_len);
+        if (cmd_find(command, command_len, hash) != NULL)
+        {   return false;   }
+    }
+
+    // Set the table
+    cmd_table = table;
+
+    // Use the builtin "help" command if no custom one is provided
+    hash = cmd_hash(CMD_HELP, &command_len);
+    use_builtin_help_cmd = (cmd_table_find(CMD_HELP, hash) == NULL) &&
+            (cmd_find(CMD_HELP, command_len, hash) == NULL);
+#if defined(MINBASECLI_CMD_STATS)
+    hash = cmd_hash(CMD_STATS, &command_len);
+    use_builtin_stats_cmd = (cmd_table_find(CMD_STATS, hash) == NULL) &&
+            (cmd_find(CMD_STATS, command_len, hash) == NULL);
+#endif
+
+    return true;
+}
+
+#endif
+
+/**
+ * @details
+ * This function calls to manage the CLI to check if there is any new command
+ * received available to be handled, then handles it through dispatch_cmd()
+ * and sends all the output that the command has generated through the
+ * interface.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::run()
+{
+    bool cmd_handled = false;
+
+    // Do nothing if there is no added commands
+    if (any_cmd() == false)
+    {   return false;   }
+
+    // Check if there is any new command received by the CLI and handle it
+    if (manage(&cli_result))
+    {   cmd_handled = dispatch_cmd();   }
+
+#if defined(MINBASECLI_CMD_ASYNC)
+    // Send the responses of the ended asynchronous commands
+    async_emit();
+#endif
+
+    // Send any pending output of the command
+    tx_response_end();
+
+    return cmd_handled;
+}
+
+/**
+ * @details
+ * This function sends any pending output and then checks if there is any
+ * received line already stored in the read buffer (a single chunk of
+ * interface data can contain several lines). If there is not, it blocks on
+ * the interface HAL wait until new data is received or the timeout expires
+ * (the wait is limited to TX_PENDING_WAIT_MS if there is output that a
+ * non-blocking output policy has not been able to send yet, so the caller
+ * loop keeps draining it). With asynchronous commands, it doesn't wait if
+ * there is an ended command response to be sent, and the wait is limited to
+ * ASYNC_PENDING_WAIT_MS while there are commands running.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::wait_for_input(const uint32_t timeout_ms)
+{
+#if defined(MINBASECLI_CMD_ASYNC)
+    bool async_running = false;
+#endif
+
+    // Do nothing if interface has not been initialized
+    if (iface_is_not_initialized())
+    {   return false;   }
+
+    // Send any pending output before waiting
+    tx_response_end();
+
+    // Don't wait if a received line is pending to be handled
+    if (iface_line_pending())
+    {   return true;   }
+
+    if ( (this->tx_buffer_len > 0U) && (timeout_ms > TX_PENDING_WAIT_MS) )
+    {   return this->hal_iface_wait(TX_PENDING_WAIT_MS);   }
+
+#if defined(MINBASECLI_CMD_ASYNC)
+    // Don't wait if an asynchronous command response is pending to be sent
+    if (async_ready(&async_running) != NULL)
+    {   return true;   }
+    if (async_running && (timeout_ms > ASYNC_PENDING_WAIT_MS))
+    {   return this->hal_iface_wait(ASYNC_PENDING_WAIT_MS);   }
+#endif
+
+    return this->hal_iface_wait(timeout_ms);
+}
+
+/**
+ * @details
+ * This function waits for received data and then calls to run().
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::run_wait(const uint32_t timeout_ms)
+{
+    wait_for_input(timeout_ms);
+    return run();
+}
+
+/**
+ * @details
+ * This function loops calling to manage() and dispatch_cmd() to handle all
+ * the received lines that are already available (the ones that are pending
+ * in the read buffer and the ones that can be read from the interface),
+ * stopping when the lines or the time budget limit is reached. The output is
+ * not sent at each new line or response (as in run_lines()), but once at the
+ * end of the batch (or each time the TX buffer gets full).
+ */
+template <class HAL, class CFG>
+uint32_t MINBASECLI_CORE<HAL, CFG>::run_batch(const uint32_t max_lines,
+        const uint32_t budget_us, bool* pending)
+{
+    uint32_t num_lines = 0U;
+    uint32_t t_start = 0U;
+
+    if (pending != NULL)
+    {   *pending = false;   }
+
+    // Do nothing if there is no added commands
+    if (any_cmd() == false)
+    {   return 0;   }
+
+    if (budget_us > 0U)
+    {   t_start = this->hal_time_us();   }
+
+    // Handle each received command line until a limit is reached
+    this->tx_line_flush = false;
+    while (manage(&cli_result))
+    {
+        dispatch_cmd();
+        num_lines = num_lines + 1U;
+        if ( (max_lines > 0U) && (num_lines >= max_lines) )
+        {   break;   }
+        if ( (budget_us > 0U) &&
+             ((this->hal_time_us() - t_start) >= budget_us) )
+        {   break;   }
+    }
+
+#if defined(MINBASECLI_CMD_ASYNC)
+    // Send the responses of the ended asynchronous commands
+    async_emit();
+#endif
+
+    // Send any pending output of the commands
+    this->tx_line_flush = true;
+    tx_response_end();
+
+    // Check for input pending to be handled
+    if (pending != NULL)
+    {
+        *pending = ( iface_line_pending() ||
+                (this->hal_iface_available() > 0U) );
+    }
+
+    return num_lines;
+}
+
+/**
+ * @details
+ * This function handles all the commands that have been received (a single
+ * chunk of interface data can contain several command lines, and the ones
+ * that follows the first are kept in the read buffer), so it can be called
+ * when the interface is ready to be read without leaving any command pending
+ * until the next interface data reception.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::iface_ready()
+{
+    // Do nothing if there is no added commands
+    if (any_cmd() == false)
+    {   return;   }
+
+    // Handle each received command
+    while (manage(&cli_result))
+    {   dispatch_cmd();   }
+
+#if defined(MINBASECLI_CMD_ASYNC)
+    // Send the responses of the ended asynchronous commands
+    async_emit();
+#endif
+
+    // Send any pending output of the commands
+    tx_response_end();
+}
+
+/**
+ * @details
+ * This function is a C-style readiness callback to be registered in event
+ * loops, that just calls to iface_ready() of the provided CLI.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::iface_ready_callback(void* cli)
+{
+    ((MINBASECLI_CORE*)(cli))->iface_ready();
+}
+
+/**
+ * @details
+ * This function search each End-Of-Line of the script data with memchr(),
+ * copies the line to a local buffer (so the script data can be read-only,
+ * i.e. a memory-mapped file), truncating it to the read buffer size, and
+ * then tokenizes and dispatches it as a received command. The output is
+ * not sent at each new line while the script is executed.
+ */
+template <class HAL, class CFG>
+size_t MINBASECLI_CORE<HAL, CFG>::run_lines(const char* data,
+        const size_t data_len, const bool data_end, t_cli_script_stats* stats)
+{
+    char line[CFG::MAX_READ_SIZE];
+    t_cli_script_stats ignored_stats;
+    const char* eol = NULL;
+    size_t pos = 0U;
+    size_t next = 0U;
+    size_t line_len = 0U;
+
+    if (stats == NULL)
+    {
+        memset(&ignored_stats, 0, sizeof(ignored_stats));
+        stats = &ignored_stats;
+    }
+
+    this->tx_line_flush = false;
+    while (pos < data_len)
+    {
+        // Find the line end (keep an incomplete last line for the next call)
+        eol = (const char*)(memchr(&(data[pos]), '\n', data_len - pos));
+        if (eol != NULL)
+        {
+            line_len = (size_t)(eol - &(data[pos]));
+            next = pos + line_len + 1U;
+        }
+        else if (data_end)
+        {
+            line_len = data_len - pos;
+            next = data_len;
+        }
+        else
+        {   break;   }
+
+        // Ignore the CR of CRLF
+        if ( (line_len > 0U) && (data[pos + line_len - 1U] == '\r') )
+        {   line_len = line_len - 1U;   }
+
+        // Truncate lines that doesn't fit in the read buffer
+        if (line_len > CFG::MAX_READ_SIZE - 1U)
+        {
+            line_len = CFG::MAX_READ_SIZE - 1U;
+            stats->truncated = stats->truncated + 1U;
+        }
+        memcpy(line, &(data[pos]), line_len);
+        pos = next;
+        stats->lines = stats->lines + 1U;
+
+        // Get the command and arguments
+        set_default_result(&cli_result);
+        str_tokenize(line, line_len, &cli_result);
+
+        // Skip empty and comment lines
+        if ( (cli_result.cmd_len == 0U) || (cli_result.cmd[0] == '#') )
+        {   continue;   }
+
+        // Handle the command (a new response that is not truncated)
+        this->tx_truncating = false;
+        if (dispatch_cmd())
+        {   stats->commands = stats->commands + 1U;   }
+        else
+        {   stats->unknown = stats->unknown + 1U;   }
+    }
+    this->tx_line_flush = true;
+
+    // Send any pending output of the commands
+    tx_response_end();
+
+    return pos;
+}
+
+#if defined(MINBASECLI_SCRIPT_FILE)
+
+/**
+ * @details
+ * This function opens the script file and checks its type. Regular files are
+ * memory-mapped (read-only, with sequential access advice) and executed
+ * through a single run_lines() call, other files (pipes, character devices)
+ * are streamed through run_fd().
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::run_file(const char* path,
+        t_cli_script_stats* stats)
+{
+    struct stat file_stat;
+    void* file_data = NULL;
+    int fd = STDIN_FILENO;
+    bool result = true;
+
+    // Open the script file
+    if ( (path != NULL) && (strcmp(path, "-") != 0) )
+    {
+        fd = open(path, O_RDONLY);
+        if (fd < 0)
+        {   return false;   }
+    }
+
+    if (fstat(fd, &file_stat) < 0)
+    {   result = false;   }
+    else if ( S_ISREG(file_stat.st_mode) && (file_stat.st_size > 0) )
+    {
+        // Map the whole file and execute it
+        file_data = mmap(NULL, (size_t)(file_stat.st_size), PROT_READ,
+                MAP_PRIVATE, fd, 0);
+        if (file_data == MAP_FAILED)
+        {   result = run_fd(fd, stats);   }
+        else
+        {
+            madvise(file_data, (size_t)(file_stat.st_size), MADV_SEQUENTIAL);
+            run_lines((const char*)(file_data), (size_t)(file_stat.st_size),
+                    true, stats);
+            munmap(file_data, (size_t)(file_stat.st_size));
+        }
+    }
+    else
+    {   result = run_fd(fd, stats);   }
+
+    if (fd != STDIN_FILENO)
+    {   close(fd);   }
+
+    return result;
+}
+
+/**
+ * @details
+ * This function reads the file descriptor in large chunks and executes the
+ * complete lines of each one through run_lines(), moving the incomplete last
+ * line to the chunk start for the next read. If the chunk gets full without
+ * any End-Of-Line, it is executed as a truncated line and the rest of that
+ * line is discarded until its End-Of-Line (as run_lines() does with a
+ * memory-mapped file). Non-blocking file descriptors are waited with poll().
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::run_fd(const int fd, t_cli_script_stats* stats)
+{
+    char chunk[MINBASECLI_SCRIPT_CHUNK_SIZE];
+    struct pollfd fd_poll;
+    const char* eol = NULL;
+    size_t chunk_len = 0U;
+    size_t used = 0U;
+    ssize_t rc = 0;
+    bool discarding = false;
+
+    fd_poll.fd = fd;
+    fd_poll.events = POLLIN;
+
+    while (true)
+    {
+        rc = read(fd, &(chunk[chunk_len]),
+                MINBASECLI_SCRIPT_CHUNK_SIZE - chunk_len);
+        if (rc < 0)
+        {
+            if (errno == EINTR)
+            {   continue;   }
+            if ( (errno == EAGAIN) || (errno == EWOULDBLOCK) )
+            {
+                poll(&fd_poll, 1, -1);
+                continue;
+            }
+            return false;
+        }
+
+        // Execute the last line at the end of the input
+        if (rc == 0)
+        {
+            run_lines(chunk, chunk_len, true, stats);
+            return true;
+        }
+        chunk_len = chunk_len + (size_t)(rc);
+
+        // Discard the rest of a truncated line until its End-Of-Line
+        if (discarding)
+        {
+            eol = (const char*)(memchr(chunk, '\n', chunk_len));
+            if (eol == NULL)
+            {
+                chunk_len = 0U;
+                continue;
+            }
+            used = (size_t)(eol - chunk) + 1U;
+            chunk_len = chunk_len - used;
+            memmove(chunk, &(chunk[used]), chunk_len);
+            discarding = false;
+        }
+
+        // Execute the complete lines and keep the incomplete one (or
+        // execute the full chunk if it has no End-Of-Line, and discard the
+        // rest of its line)
+        used = run_lines(chunk, chunk_len, false, stats);
+        if ( (used == 0U) && (chunk_len == MINBASECLI_SCRIPT_CHUNK_SIZE) )
+        {
+            used = run_lines(chunk, chunk_len, true, stats);
+            discarding = true;
+        }
+        chunk_len = chunk_len - used;
+        memmove(chunk, &(chunk[used]), chunk_len);
+    }
+}
+
+#endif
+
+/**
+ * @details
+ * This function checks and get any received data from the CLI interface and
+ * parse to handle it as a command with arguments, populating the t_result
+ * element to be returned as reference at the end of the function. The command
+ * and arguments are not copied, they point to the read buffer.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::manage(t_result* cli_result)
+{
+    uint32_t received_bytes = 0;
+
+    // Set default null result
+    set_default_result(cli_result);
+
+    // Do nothing if interface has not been initialized
+    if (iface_is_not_initialized())
+    {   return false;   }
+
+    // Send any pending output from the previous command handling
+    tx_response_end();
+
+    // Check if any command has been received
+    if (iface_read_data(this->rx_read, CFG::MAX_READ_SIZE) == false)
+    {   return false;   }
+    received_bytes = get_received_bytes();
+    this->received_bytes = 0;
+
+    // Shows the received command
+    this->printstr("# ", 2U);
+    this->printstr(this->rx_read, received_bytes);
+    this->printstr("\n", 1U);
+
+    // Get the command and arguments
+    str_tokenize(this->rx_read, received_bytes, cli_result);
+    MINBASECLI_TRACE_PARSE_POINT(this, cli_result->argc, cli_result->cmd);
+
+    return true;
+}
+
+/**
+ * @details
+ * This function gets the variadic arguments list and calls to vprintf().
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::printf(const char* fstr, ...)
+{
+    va_list lst;
+
+    va_start(lst, fstr);
+    vprintf(fstr, lst);
+    va_end(lst);
+}
+
+/**
+ * @details
+ * This function formats the text with the CLI output (the transmission
+ * buffer) as output destination.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::vprintf(const char* fstr, va_list lst)
+{
+    t_cli_fmt_out out;
+
+    out.str = NULL;
+    out.str_size = 0U;
+    out.len = 0U;
+    fmt_vformat(&out, fstr, lst);
+}
+
+/**
+ * @details
+ * This function gets the variadic arguments list and calls to vsnprintf().
+ */
+template <class HAL, class CFG>
+int MINBASECLI_CORE<HAL, CFG>::snprintf(char* str, const size_t str_size,
+        const char* fstr, ...)
+{
+    va_list lst;
+    int len = 0;
+
+    va_start(lst, fstr);
+    len = vsnprintf(str, str_size, fstr, lst);
+    va_end(lst);
+
+    return len;
+}
+
+/**
+ * @details
+ * This function formats the text with the provided string buffer as output
+ * destination, and null terminates it (a NULL buffer with zero size can be
+ * used to just get the formatted text length).
+ */
+template <class HAL, class CFG>
+int MINBASECLI_CORE<HAL, CFG>::vsnprintf(char* str, const size_t str_size,
+        const char* fstr, va_list lst)
+{
+    t_cli_fmt_out out;
+    char empty_str = '\0';
+
+    out.str = str;
+    out.str_size = str_size;
+    out.len = 0U;
+    if (str == NULL)
+    {
+        out.str = &empty_str;
+        out.str_size = 0U;
+    }
+    fmt_vformat(&out, fstr, lst);
+
+    // Null terminate the string
+    if (out.str_size > 0U)
+    {
+        if (out.len < out.str_size)
+        {   out.str[out.len] = '\0';   }
+        else
+        {   out.str[out.str_size - 1U] = '\0';   }
+    }
+
+    return (int)(out.len);
+}
+
+/**
+ * @details
+ * This function sends all the bytes stored in the transmission ring buffer
+ * through the interface with blocking HAL write calls (two if the pending
+ * bytes wrap around the buffer end), and empty the buffer.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::flush()
+{
+    size_t first_len = CFG::MAX_TX_SIZE - this->tx_buffer_tail;
+
+#if defined(MINBASECLI_CMD_ASYNC)
+    // Asynchronous commands output is sent by the CLI thread
+    if (async_job != NULL)
+    {   return;   }
+#endif
+
+    if (this->tx_buffer_len == 0U)
+    {   return;   }
+    MINBASECLI_TRACE_TX_BEGIN_POINT(this, this->tx_buffer_len);
+
+    if (first_len > this->tx_buffer_len)
+    {   first_len = this->tx_buffer_len;   }
+    this->hal_iface_write(&(this->tx_buffer[this->tx_buffer_tail]), first_len);
+    if (this->tx_buffer_len > first_len)
+    {
+        this->hal_iface_write(this->tx_buffer,
+                this->tx_buffer_len - first_len);
+    }
+    this->tx_buffer_len = 0U;
+    this->tx_buffer_tail = 0U;
+    MINBASECLI_TRACE_TX_END_POINT(this, 0U);
+}
+
+/**
+ * @details
+ * This function offers the pending bytes of the transmission ring buffer to
+ * the interface non-blocking HAL write, in contiguous blocks from the oldest
+ * one, until all have been sent or the interface doesn't accept more.
+ */
+template <class HAL, class CFG>
+size_t MINBASECLI_CORE<HAL, CFG>::drain_output()
+{
+    size_t block_len = 0U;
+    size_t sent = 0U;
+
+#if defined(MINBASECLI_CMD_ASYNC)
+    // Asynchronous commands output is sent by the CLI thread
+    if (async_job != NULL)
+    {   return 0U;   }
+#endif
+
+    if (this->tx_buffer_len == 0U)
+    {   return 0U;   }
+    MINBASECLI_TRACE_TX_BEGIN_POINT(this, this->tx_buffer_len);
+
+    while (this->tx_buffer_len > 0U)
+    {
+        block_len = CFG::MAX_TX_SIZE - this->tx_buffer_tail;
+        if (block_len > this->tx_buffer_len)
+        {   block_len = this->tx_buffer_len;   }
+        sent = this->hal_iface_try_write(
+                &(this->tx_buffer[this->tx_buffer_tail]), block_len);
+        if (sent == 0U)
+        {   break;   }
+        this->tx_buffer_tail = (this->tx_buffer_tail + sent) %
+                CFG::MAX_TX_SIZE;
+        this->tx_buffer_len = this->tx_buffer_len - sent;
+    }
+    if (this->tx_buffer_len == 0U)
+    {   this->tx_buffer_tail = 0U;   }
+    MINBASECLI_TRACE_TX_END_POINT(this, this->tx_buffer_len);
+
+    return this->tx_buffer_len;
+}
+
+/**
+ * @details
+ * This function checks and sets the output policy (the pending output is not
+ * modified).
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::set_tx_policy(const uint8_t policy)
+{
+    if (policy > MINBASECLI_TX_POLICY_TRUNCATE)
+    {   return false;   }
+
+    this->tx_policy = policy;
+    this->tx_truncating = false;
+
+    return true;
+}
+
+/**
+ * @details
+ * This function returns the number of output bytes discarded by the drop
+ * output policies.
+ */
+template <class HAL, class CFG>
+uint32_t MINBASECLI_CORE<HAL, CFG>::get_tx_dropped_bytes()
+{
+    return this->tx_dropped;
+}
+
+/**
+ * @details
+ * This function returns the number of output bytes discarded by the
+ * truncate output policy.
+ */
+template <class HAL, class CFG>
+uint32_t MINBASECLI_CORE<HAL, CFG>::get_tx_truncated_bytes()
+{
+    return this->tx_truncated;
+}
+
+/**
+ * @details
+ * This function returns the number of received bytes that the interface HAL
+ * has discarded (i.e. the read thread ring buffer was full because the CLI
+ * was not reading it fast enough).
+ */
+template <class HAL, class CFG>
+uint32_t MINBASECLI_CORE<HAL, CFG>::get_rx_dropped_bytes()
+{
+    return this->hal_iface_rx_dropped();
+}
+
+/**
+ * @details
+ * This function is called when a "help" command is received through the CLI
+ * if any command has been added to be handled through a callback and the
+ * "help" command has not been added. It shows the list of commands that are
+ * added and the descriptions of them.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::cmd_help(int argc, char* argv[])
+{
+    // Do nothing if there is no added commands
+    if (any_cmd() == false)
+    {   return;   }
+
+    // Shows each added command descriptions
+    this->printf("\nAvailable commands:\n\n");
+
+#if defined(MINBASECLI_CMD_TRIE)
+    // Shows just the commands under the requested commands path
+    if ( (argc > 0) && cmd_trie_help(argc, argv, t_cmd_index_tag()) )
+    {
+        this->printf("\n");
+        return;
+    }
+#endif
+
+    // Shows help description info
+    if (use_builtin_help_cmd)
+    {   this->printf("%s - %s\n", CMD_HELP, CMD_HELP_DESCRIPTION);   }
+#if defined(MINBASECLI_CMD_STATS)
+    if (use_builtin_stats_cmd)
+    {   this->printf("%s - %s\n", CMD_STATS, CMD_STATS_DESCRIPTION);   }
+#endif
+
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+    // Shows all constant command table descriptions
+    for (uint8_t i = 0U; i < cmd_table.num_entries; i++)
+    {
+        this->printf("%s - %s\n", cmd_table.entries[i].command,
+                cmd_table.entries[i].description);
+    }
+#endif
+
+    // Shows all added command descriptions
+    for (uint8_t i = 0U; i < num_added_commands; i++)
+    {   print_cmd_info(&(added_commands[i]));   }
+
+    this->printf("\n");
+}
+
+#if defined(MINBASECLI_CMD_STATS)
+
+/**
+ * @details
+ * This function looks for the added command through the hash index and
+ * copies its statistics.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::get_cmd_stats(const char* command,
+        t_cli_cmd_stats* stats)
+{
+    t_cmd_cb_info* cmd_cb_info = NULL;
+    size_t command_len = 0U;
+    uint32_t hash = 0U;
+
+    if ( (command == NULL) || (stats == NULL) )
+    {   return false;   }
+
+    hash = cmd_hash(command, &command_len);
+    cmd_cb_info = cmd_find(command, command_len, hash);
+    if (cmd_cb_info == NULL)
+    {   return false;   }
+
+    *stats = cmd_cb_info->stats;
+    return true;
+}
+
+/**
+ * @details
+ * This function clears the statistics of each added command.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::reset_cmd_stats()
+{
+    for (uint8_t i = 0U; i < num_added_commands; i++)
+    {
+        memset(&(added_commands[i].stats), 0,
+                sizeof(added_commands[i].stats));
+    }
+}
+
+/**
+ * @details
+ * This function is called when a "stats" command is received through the
+ * CLI if the "stats" command has not been added. It shows the calls
+ * statistics of the added commands (in the order that they were added), or
+ * clears them for "stats reset".
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::cmd_stats(int argc, char* argv[])
+{
+    if ( (argc > 0) && (strcmp(argv[0], "reset") == 0) )
+    {
+        reset_cmd_stats();
+        this->printf("Commands statistics cleared.\n");
+        return;
+    }
+
+    this->printf("\nCommands statistics (times in us):\n\n");
+    for (uint8_t i = 0U; i < num_added_commands; i++)
+    {   print_cmd_stats(&(added_commands[i]));   }
+    this->printf("\n");
+}
+
+#endif
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details
+ * This function print all the characters of the provided string until an
+ * end of string null character is found ('\0').
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::printstr(const char* str)
+{
+    tx_write((const uint8_t*)(str), strlen(str));
+}
+
+/**
+ * @details
+ * This function print the provided number of characters of the provided
+ * string.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::printstr(const char* str, const size_t str_len)
+{
+    tx_write((const uint8_t*)(str), str_len);
+}
+
+#if defined(MINBASECLI_CMD_PROGMEM)
+
+/**
+ * @details
+ * This function loop and print each character of the provided program
+ * memory string until the provided number of characters has been printed.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::printstr_P(PGM_P str, const size_t str_len)
+{
+    for (size_t i = 0U; i < str_len; i++)
+    {   tx_put(pgm_read_byte(str + i));   }
+}
+
+#endif
+
+/**
+ * @details
+ * This function stores the provided byte in the transmission buffer (if the
+ * output policy lets it), and sends the buffer if it is a new line character
+ * or if the buffer is full.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::tx_put(const uint8_t data_byte)
+{
+    tx_write(&data_byte, 1U);
+}
+
+/**
+ * @details
+ * This function gets space in the transmission buffer for the provided block
+ * of bytes (applying the output policy), copies the part of the block that
+ * can be stored (the newest bytes with the DROP_OLDEST policy) and counts
+ * the discarded ones. With the BLOCK policy, blocks that are larger than the
+ * buffer are written directly to the interface after sending the pending
+ * data. The buffer is sent at the end if the block contains a new line
+ * character or if the buffer is full. The output of an asynchronous command
+ * is written to its own buffer instead.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::tx_write(const uint8_t* data,
+        const size_t data_len)
+{
+    size_t store_len = 0U;
+    size_t discard_len = 0U;
+
+    if (data_len == 0U)
+    {   return;   }
+
+#if defined(MINBASECLI_CMD_ASYNC)
+    // Write the output of an asynchronous command to its buffer
+    if (async_job != NULL)
+    {
+        async_write(data, data_len);
+        return;
+    }
+#endif
+
+    // Discard the rest of a truncated response
+    if (this->tx_truncating)
+    {
+        this->tx_truncated = this->tx_truncated + (uint32_t)(data_len);
+        return;
+    }
+
+    // Write large blocks without copying them
+    if ( (this->tx_policy == MINBASECLI_TX_POLICY_BLOCK) &&
+         (data_len >= CFG::MAX_TX_SIZE) )
+    {
+        flush();
+        this->hal_iface_write(data, data_len);
+        return;
+    }
+
+    // Store the block (or the part of it that the output policy lets)
+    store_len = tx_reserve(data_len);
+    discard_len = data_len - store_len;
+    if (discard_len > 0U)
+    {
+        if (this->tx_policy == MINBASECLI_TX_POLICY_TRUNCATE)
+        {
+            this->tx_truncated = this->tx_truncated + (uint32_t)(discard_len);
+            this->tx_truncating = true;
+        }
+        else
+        {   this->tx_dropped = this->tx_dropped + (uint32_t)(discard_len);   }
+    }
+    if (this->tx_policy == MINBASECLI_TX_POLICY_DROP_OLDEST)
+    {   tx_store(&(data[discard_len]), store_len);   }
+    else
+    {   tx_store(data, store_len);   }
+
+    // Send the buffer if the block contains a new line or it is full
+    if ( (this->tx_buffer_len >= CFG::MAX_TX_SIZE) ||
+         (this->tx_line_flush && (memchr(data, '\n', data_len) != NULL)) )
+    {   tx_send();   }
+}
+
+/**
+ * @details
+ * This function checks the free space of the transmission buffer, and if it
+ * is not enough for the new data, it first sends the pending data that the
+ * interface accepts without blocking and then applies the output policy:
+ * BLOCK sends all the pending data (blocking), DROP_OLDEST discards the
+ * oldest pending bytes (as many as needed, counted as dropped), and
+ * DROP_NEWEST and TRUNCATE just let the free space be used.
+ */
+template <class HAL, class CFG>
+size_t MINBASECLI_CORE<HAL, CFG>::tx_reserve(const size_t data_len)
+{
+    size_t free_len = CFG::MAX_TX_SIZE - this->tx_buffer_len;
+    size_t drop_len = 0U;
+
+    if (data_len <= free_len)
+    {   return data_len;   }
+
+    drain_output();
+    free_len = CFG::MAX_TX_SIZE - this->tx_buffer_len;
+    if (data_len <= free_len)
+    {   return data_len;   }
+
+    if (this->tx_policy == MINBASECLI_TX_POLICY_BLOCK)
+    {
+        flush();
+        free_len = CFG::MAX_TX_SIZE;
+    }
+    else if (this->tx_policy == MINBASECLI_TX_POLICY_DROP_OLDEST)
+    {
+        drop_len = data_len - free_len;
+        if (drop_len > this->tx_buffer_len)
+        {   drop_len = this->tx_buffer_len;   }
+        this->tx_buffer_tail = (this->tx_buffer_tail + drop_len) %
+                CFG::MAX_TX_SIZE;
+        this->tx_buffer_len = this->tx_buffer_len - drop_len;
+        this->tx_dropped = this->tx_dropped + (uint32_t)(drop_len);
+        free_len = free_len + drop_len;
+    }
+
+    if (data_len < free_len)
+    {   return data_len;   }
+    return free_len;
+}
+
+/**
+ * @details
+ * This function copies the block of bytes after the pending ones, in two
+ * parts if the buffer end is reached. The caller ensures that it fits.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::tx_store(const uint8_t* data,
+        const size_t data_len)
+{
+    size_t head = (this->tx_buffer_tail + this->tx_buffer_len) %
+            CFG::MAX_TX_SIZE;
+    size_t first_len = CFG::MAX_TX_SIZE - head;
+
+    if (data_len == 0U)
+    {   return;   }
+
+    if (first_len > data_len)
+    {   first_len = data_len;   }
+    memcpy(&(this->tx_buffer[head]), data, first_len);
+    memcpy(this->tx_buffer, &(data[first_len]), data_len - first_len);
+    this->tx_buffer_len = this->tx_buffer_len + data_len;
+}
+
+/**
+ * @details
+ * This function sends the pending output waiting for the interface with the
+ * BLOCK output policy, or just the part that the interface accepts now with
+ * the other ones.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::tx_send()
+{
+    if (this->tx_policy == MINBASECLI_TX_POLICY_BLOCK)
+    {   flush();   }
+    else
+    {   drain_output();   }
+}
+
+/**
+ * @details
+ * This function ends the truncation of the current response (if any) and
+ * sends the pending output, unless the output is being sent in full buffer
+ * blocks (while handling a batch of lines).
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::tx_response_end()
+{
+    this->tx_truncating = false;
+    if (this->tx_line_flush)
+    {   tx_send();   }
+}
+
+/**
+ * @details
+ * This function implements the C STDIO printf() format engine. It loops over
+ * the format string writing each run of plain text with a single block
+ * write, and parsing each conversion specification ("%[flags][width]
+ * [.precision][length]conversion") to get the argument of the specified
+ * type from the variadic arguments list and write it converted. Unsupported
+ * conversions are not written.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::fmt_vformat(t_cli_fmt_out* out,
+        const char* fstr, va_list lst)
+{
+    const char* fstr_run = NULL;
+    t_cli_fmt_spec spec;
+    uint8_t length = FMT_LEN_NONE;
+    uint8_t base = 10U;
+    int64_t snum = 0;
+    uint64_t unum = 0U;
+    char sign = '\0';
+    char conv = '\0';
+
+    while (*fstr != '\0')
+    {
+        // Just write the text until a start format symbol is reach
+        if (*fstr != '%')
+        {
+            fstr_run = fstr;
+            while ( (*fstr != '\0') && (*fstr != '%') )
+            {   fstr = fstr + 1;   }
+            fmt_write(out, fstr_run, (size_t)(fstr - fstr_run));
+            continue;
+        }
+        fstr = fstr + 1;
+
+        // Get the flags
+        spec.flags = 0U;
+        while (true)
+        {
+            if (*fstr == '-')
+            {   spec.flags = spec.flags | MINBASECLI_FMT_FLAG_LEFT;   }
+            else if (*fstr == '+')
+            {   spec.flags = spec.flags | MINBASECLI_FMT_FLAG_PLUS;   }
+            else if (*fstr == ' ')
+            {   spec.flags = spec.flags | MINBASECLI_FMT_FLAG_SPACE;   }
+            else if (*fstr == '#')
+            {   spec.flags = spec.flags | MINBASECLI_FMT_FLAG_ALT;   }
+            else if (*fstr == '0')
+            {   spec.flags = spec.flags | MINBASECLI_FMT_FLAG_ZERO;   }
+            else
+            {   break;   }
+            fstr = fstr + 1;
+        }
+
+        // Get the width (a negative argument width means left justify)
+        spec.width = 0;
+        if (*fstr == '*')
+        {
+            spec.width = va_arg(lst, int);
+            if (spec.width < 0)
+            {
+                spec.flags = spec.flags | MINBASECLI_FMT_FLAG_LEFT;
+                spec.width = -spec.width;
+            }
+            fstr = fstr + 1;
+        }
+        while ( (*fstr >= '0') && (*fstr <= '9') )
+        {
+            spec.width = (spec.width * 10) + (*fstr - '0');
+            fstr = fstr + 1;
+        }
+
+        // Get the precision (a negative argument precision means none)
+        spec.precision = -1;
+        if (*fstr == '.')
+        {
+            fstr = fstr + 1;
+            spec.precision = 0;
+            if (*fstr == '*')
+            {
+                spec.precision = va_arg(lst, int);
+                if (spec.precision < 0)
+                {   spec.precision = -1;   }
+                fstr = fstr + 1;
+            }
+            while ( (*fstr >= '0') && (*fstr <= '9') )
+            {
+                spec.precision = (spec.precision * 10) + (*fstr - '0');
+                fstr = fstr + 1;
+            }
+        }
+
+        // Get the length modifier
+        length = FMT_LEN_NONE;
+        if (*fstr == 'h')
+        {
+            fstr = fstr + 1;
+            length = FMT_LEN_H;
+            if (*fstr == 'h')
+            {
+                fstr = fstr + 1;
+                length = FMT_LEN_HH;
+            }
+        }
+        else if (*fstr == 'l')
+        {
+            fstr = fstr + 1;
+            length = FMT_LEN_L;
+            if (*fstr == 'l')
+            {
+                fstr = fstr + 1;
+                length = FMT_LEN_LL;
+            }
+        }
+        else if (*fstr == 'z')
+        {
+            fstr = fstr + 1;
+            length = FMT_LEN_Z;
+        }
+        else if (*fstr == 'j')
+        {
+            fstr = fstr + 1;
+            length = FMT_LEN_J;
+        }
+        else if (*fstr == 't')
+        {
+            fstr = fstr + 1;
+            length = FMT_LEN_T;
+        }
+        else if (*fstr == 'L')
+        {
+            fstr = fstr + 1;
+            length = FMT_LEN_LD;
+        }
+
+        // Get the conversion
+        conv = *fstr;
+        if (conv == '\0')
+        {   break;   }
+        fstr = fstr + 1;
+
+        // Format Signed Integer
+        if ( (conv == 'd') || (conv == 'i') )
+        {
+            if (length == FMT_LEN_HH)
+            {   snum = (int64_t)((signed char)(va_arg(lst, int)));   }
+            else if (length == FMT_LEN_H)
+            {   snum = (int64_t)((short)(va_arg(lst, int)));   }
+            else if (length == FMT_LEN_L)
+            {   snum = (int64_t)(va_arg(lst, long));   }
+            else if (length == FMT_LEN_LL)
+            {   snum = (int64_t)(va_arg(lst, long long));   }
+            else if (length == FMT_LEN_Z)
+            {   snum = (int64_t)((ptrdiff_t)(va_arg(lst, size_t)));   }
+            else if (length == FMT_LEN_J)
+            {   snum = (int64_t)(va_arg(lst, intmax_t));   }
+            else if (length == FMT_LEN_T)
+            {   snum = (int64_t)(va_arg(lst, ptrdiff_t));   }
+            else
+            {   snum = (int64_t)(va_arg(lst, int));   }
+
+            sign = '\0';
+            unum = (uint64_t)(snum);
+            if (snum < 0)
+            {
+                sign = '-';
+                unum = (uint64_t)(0U) - unum;
+            }
+            else if (spec.flags & MINBASECLI_FMT_FLAG_PLUS)
+            {   sign = '+';   }
+            else if (spec.flags & MINBASECLI_FMT_FLAG_SPACE)
+            {   sign = ' ';   }
+            fmt_integer(out, unum, sign, 10U, &spec);
+        }
+
+        // Format Unsigned integer, Octal and Hexadecimal
+        else if ( (conv == 'u') || (conv == 'o') || (conv == 'x') ||
+                  (conv == 'X') )
+        {
+            if (length == FMT_LEN_HH)
+            {   unum = (uint64_t)((unsigned char)(va_arg(lst, unsigned)));   }
+            else if (length == FMT_LEN_H)
+            {   unum = (uint64_t)((unsigned short)(va_arg(lst, unsigned)));   }
+            else if (length == FMT_LEN_L)
+            {   unum = (uint64_t)(va_arg(lst, unsigned long));   }
+            else if (length == FMT_LEN_LL)
+            {   unum = (uint64_t)(va_arg(lst, unsigned long long));   }
+            else if (length == FMT_LEN_Z)
+            {   unum = (uint64_t)(va_arg(lst, size_t));   }
+            else if (length == FMT_LEN_J)
+            {   unum = (uint64_t)(va_arg(lst, uintmax_t));   }
+            else if (length == FMT_LEN_T)
+            {   unum = (uint64_t)((size_t)(va_arg(lst, ptrdiff_t)));   }
+            else
+            {   unum = (uint64_t)(va_arg(lst, unsigned));   }
+
+            base = 10U;
+            if (conv == 'o')
+            {   base = 8U;   }
+            else if ( (conv == 'x') || (conv == 'X') )
+            {   base = 16U;   }
+            if (conv == 'X')
+            {   spec.flags = spec.flags | MINBASECLI_FMT_FLAG_UPPER;   }
+            fmt_integer(out, unum, '\0', base, &spec);
+        }
+
+        // Format Pointer
+        else if (conv == 'p')
+        {
+            unum = (uint64_t)((uintptr_t)(va_arg(lst, void*)));
+            spec.flags = spec.flags | MINBASECLI_FMT_FLAG_ALT;
+            fmt_integer(out, unum, '\0', 16U, &spec);
+        }
+
+        // Format Character
+        else if (conv == 'c')
+        {   fmt_char(out, (char)(va_arg(lst, int)), &spec);   }
+
+        // Format String
+        else if (conv == 's')
+        {   fmt_string(out, va_arg(lst, const char*), &spec);   }
+
+        // Format Floating Point
+        else if ( (conv == 'f') || (conv == 'F') )
+        {
+#if defined(MINBASECLI_PRINTF_FLOAT)
+            if (conv == 'F')
+            {   spec.flags = spec.flags | MINBASECLI_FMT_FLAG_UPPER;   }
+            if (length == FMT_LEN_LD)
+            {   fmt_float(out, (double)(va_arg(lst, long double)), &spec);   }
+            else
+            {   fmt_float(out, va_arg(lst, double), &spec);   }
+#else
+            // Floating point support disabled, skip the argument
+            if (length == FMT_LEN_LD)
+            {   (void)(va_arg(lst, long double));   }
+            else
+            {   (void)(va_arg(lst, double));   }
+            fmt_write(out, "?", 1U);
+#endif
+        }
+
+        // Format Percent Symbol
+        else if (conv == '%')
+        {   fmt_write(out, "%", 1U);   }
+
+        // Unsupported format
+        else
+        {
+            // Do nothing
+        }
+    }
+}
+
+/**
+ * @details
+ * This function writes the characters through the transmission buffer if
+ * the destination is the CLI output, or copies them into the destination
+ * string buffer up to its size (leaving space for the null terminator). The
+ * destination length is increased by all the characters, so the full
+ * formatted text length is known even if it has been truncated.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::fmt_write(t_cli_fmt_out* out, const char* data,
+        const size_t data_len)
+{
+    size_t copy_len = data_len;
+
+    if (out->str == NULL)
+    {   tx_write((const uint8_t*)(data), data_len);   }
+    else if (out->len + 1U < out->str_size)
+    {
+        if (copy_len > (out->str_size - 1U) - out->len)
+        {   copy_len = (out->str_size - 1U) - out->len;   }
+        memcpy(&(out->str[out->len]), data, copy_len);
+    }
+    out->len = out->len + data_len;
+}
+
+/**
+ * @details
+ * This function fills a small block with the character and writes it as
+ * many times as needed.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::fmt_pad(t_cli_fmt_out* out, const char c,
+        int count)
+{
+    char pad[FMT_PAD_BLOCK_SIZE];
+    int block_len = 0;
+
+    if (count <= 0)
+    {   return;   }
+
+    memset(pad, (int)(c), FMT_PAD_BLOCK_SIZE);
+    while (count > 0)
+    {
+        block_len = count;
+        if (block_len > (int)(FMT_PAD_BLOCK_SIZE))
+        {   block_len = (int)(FMT_PAD_BLOCK_SIZE);   }
+        fmt_write(out, pad, (size_t)(block_len));
+        count = count - block_len;
+    }
+}
+
+/**
+ * @details
+ * This function converts the number digits, gets the sign or alternative
+ * form prefix ("0x" for hexadecimal or a leading "0" for octal), the zeros
+ * needed to reach the precision (or the width with the '0' flag when there
+ * is no precision), and the spaces padding to reach the width, and writes
+ * each part in order.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::fmt_integer(t_cli_fmt_out* out,
+        const uint64_t num, const char sign, const uint8_t base,
+        const t_cli_fmt_spec* spec)
+{
+    char prefix[2];
+    size_t prefix_len = 0U;
+    size_t num_len = 0U;
+    int zeros = 0;
+    int pad = 0;
+    char* digits = this->print_array;
+
+#if defined(MINBASECLI_CMD_ASYNC)
+    // Asynchronous commands use their own conversion buffer
+    if (async_job != NULL)
+    {   digits = async_job->print_array;   }
+#endif
+
+    // Convert the number (no digits for zero with zero precision)
+    if ( (num != 0U) || (spec->precision != 0) )
+    {
+        num_len = minbasecli_u64toa(num, digits,
+                MINBASECLI_MAX_PRINT_SIZE, base);
+    }
+    if (spec->flags & MINBASECLI_FMT_FLAG_UPPER)
+    {
+        for (size_t i = 0U; i < num_len; i++)
+        {
+            if (digits[i] >= 'a')
+            {   digits[i] = (char)(digits[i] - 'a' + 'A');   }
+        }
+    }
+
+    // Get the sign or the alternative form prefix
+    if (sign != '\0')
+    {
+        prefix[0] = sign;
+        prefix_len = 1U;
+    }
+    else if ( (spec->flags & MINBASECLI_FMT_FLAG_ALT) && (base == 16U) &&
+              (num != 0U) )
+    {
+        prefix[0] = '0';
+        prefix[1] = (spec->flags & MINBASECLI_FMT_FLAG_UPPER) ? 'X' : 'x';
+        prefix_len = 2U;
+    }
+    else if ( (spec->flags & MINBASECLI_FMT_FLAG_ALT) && (base == 8U) &&
+              (spec->precision <= (int)(num_len)) &&
+              ((num_len == 0U) || (digits[0] != '0')) )
+    {
+        prefix[0] = '0';
+        prefix_len = 1U;
+    }
+
+    // Get the precision zeros and the width padding
+    if (spec->precision > (int)(num_len))
+    {   zeros = spec->precision - (int)(num_len);   }
+    pad = spec->width - (int)(prefix_len + num_len) - zeros;
+    if ( (spec->flags & MINBASECLI_FMT_FLAG_ZERO) &&
+         ((spec->flags & MINBASECLI_FMT_FLAG_LEFT) == 0U) &&
+         (spec->precision < 0) && (pad > 0) )
+    {
+        zeros = zeros + pad;
+        pad = 0;
+    }
+
+    // Write the number
+    if ((spec->flags & MINBASECLI_FMT_FLAG_LEFT) == 0U)
+    {   fmt_pad(out, ' ', pad);   }
+    fmt_write(out, prefix, prefix_len);
+    fmt_pad(out, '0', zeros);
+    fmt_write(out, digits, num_len);
+    if (spec->flags & MINBASECLI_FMT_FLAG_LEFT)
+    {   fmt_pad(out, ' ', pad);   }
+}
+
+/**
+ * @details
+ * This function gets the string length up to the precision, and writes it
+ * with the spaces padding to reach the width.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::fmt_string(t_cli_fmt_out* out, const char* str,
+        const t_cli_fmt_spec* spec)
+{
+    size_t str_len = 0U;
+    int pad = 0;
+
+    if (str == NULL)
+    {   str = "(null)";   }
+
+    while ( (str[str_len] != '\0') && ( (spec->precision < 0) ||
+            (str_len < (size_t)(spec->precision)) ) )
+    {   str_len = str_len + 1U;   }
+    pad = spec->width - (int)(str_len);
+
+    if ((spec->flags & MINBASECLI_FMT_FLAG_LEFT) == 0U)
+    {   fmt_pad(out, ' ', pad);   }
+    fmt_write(out, str, str_len);
+    if (spec->flags & MINBASECLI_FMT_FLAG_LEFT)
+    {   fmt_pad(out, ' ', pad);   }
+}
+
+/**
+ * @details
+ * This function writes the character with the spaces padding to reach the
+ * width.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::fmt_char(t_cli_fmt_out* out, const char c,
+        const t_cli_fmt_spec* spec)
+{
+    if ((spec->flags & MINBASECLI_FMT_FLAG_LEFT) == 0U)
+    {   fmt_pad(out, ' ', spec->width - 1);   }
+    fmt_write(out, &c, 1U);
+    if (spec->flags & MINBASECLI_FMT_FLAG_LEFT)
+    {   fmt_pad(out, ' ', spec->width - 1);   }
+}
+
+#if defined(MINBASECLI_PRINTF_FLOAT)
+
+/**
+ * @details
+ * This function writes the number in fixed point notation with integer
+ * arithmetic: the integer part and the fractional part (scaled by the
+ * precision and rounded half to even, up to FMT_FLOAT_MAX_DIGITS significant
+ * decimals, the next ones are written as zeros) are converted as 64 bits
+ * integers.
+ * Numbers that doesn't fit in 64 bits are scaled down and written with
+ * trailing zeros. Infinite and not a number values are written as text.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::fmt_float(t_cli_fmt_out* out, double num,
+        const t_cli_fmt_spec* spec)
+{
+    t_cli_fmt_spec text_spec;
+    char text[5];
+    uint64_t int_part = 0U;
+    uint64_t frac_part = 0U;
+    uint64_t frac_scale = 1U;
+    double frac = 0.0;
+    double prod = 0.0;
+    double prod_err = 0.0;
+    double half_dist = 0.0;
+    double split = 0.0;
+    double frac_hi = 0.0;
+    double frac_lo = 0.0;
+    double scale_hi = 0.0;
+    double scale_lo = 0.0;
+    size_t num_len = 0U;
+    int precision = spec->precision;
+    int frac_digits = 0;
+    int exp10 = 0;
+    int pad = 0;
+    bool upper = ((spec->flags & MINBASECLI_FMT_FLAG_UPPER) != 0U);
+    bool dot = false;
+    bool odd = false;
+    char sign = '\0';
+    char* digits = this->print_array;
+
+#if defined(MINBASECLI_CMD_ASYNC)
+    // Asynchronous commands use their own conversion buffer
+    if (async_job != NULL)
+    {   digits = async_job->print_array;   }
+#endif
+
+    // Get the sign
+    if (signbit(num))
+    {
+        sign = '-';
+        num = -num;
+    }
+    else if (spec->flags & MINBASECLI_FMT_FLAG_PLUS)
+    {   sign = '+';   }
+    else if (spec->flags & MINBASECLI_FMT_FLAG_SPACE)
+    {   sign = ' ';   }
+
+    // Write infinite and not a number values
+    if ((num - num) != 0.0)
+    {
+        num_len = 0U;
+        if (sign != '\0')
+        {
+            text[0] = sign;
+            num_len = 1U;
+        }
+        if (num != num)
+        {   memcpy(&(text[num_len]), (upper ? "NAN" : "nan"), 4U);   }
+        else
+        {   memcpy(&(text[num_len]), (upper ? "INF" : "inf"), 4U);   }
+        text_spec = *spec;
+        text_spec.precision = -1;
+        fmt_string(out, text, &text_spec);
+        return;
+    }
+
+    // Get the integer and fractional parts
+    if (precision < 0)
+    {   precision = FMT_FLOAT_DEFAULT_PRECISION;   }
+    frac_digits = precision;
+    if (frac_digits > FMT_FLOAT_MAX_DIGITS)
+    {   frac_digits = FMT_FLOAT_MAX_DIGITS;   }
+    for (int i = 0; i < frac_digits; i++)
+    {   frac_scale = frac_scale * 10U;   }
+    while (num >= 1e19)
+    {
+        num = num / 10.0;
+        exp10 = exp10 + 1;
+    }
+    int_part = (uint64_t)(num);
+    if (exp10 == 0)
+    {
+        // Scale the fractional part, getting the product rounding error
+        // (Dekker exact product), so halves are detected exactly
+        frac = num - (double)(int_part);
+        prod = frac * (double)(frac_scale);
+        split = FMT_FLOAT_SPLIT * frac;
+        frac_hi = split - (split - frac);
+        frac_lo = frac - frac_hi;
+        split = FMT_FLOAT_SPLIT * (double)(frac_scale);
+        scale_hi = split - (split - (double)(frac_scale));
+        scale_lo = (double)(frac_scale) - scale_hi;
+        prod_err = (((frac_hi * scale_hi) - prod) + (frac_hi * scale_lo) +
+                (frac_lo * scale_hi)) + (frac_lo * scale_lo);
+        frac_part = (uint64_t)(prod);
+
+        // Round half to even
+        half_dist = (prod - ((double)(frac_part) + 0.5)) + prod_err;
+        odd = (((frac_digits > 0) ? frac_part : int_part) & 1U) != 0U;
+        if ( (half_dist > 0.0) || ((half_dist == 0.0) && odd) )
+        {   frac_part = frac_part + 1U;   }
+        if (frac_part >= frac_scale)
+        {
+            int_part = int_part + 1U;
+            frac_part = frac_part - frac_scale;
+        }
+    }
+
+    // Convert the integer part and get the width padding
+    num_len = minbasecli_u64toa(int_part, digits,
+            MINBASECLI_MAX_PRINT_SIZE, 10U);
+    dot = ( (precision > 0) || (spec->flags & MINBASECLI_FMT_FLAG_ALT) );
+    pad = spec->width - ((sign != '\0') ? 1 : 0) - (int)(num_len) - exp10 -
+            (dot ? 1 : 0) - precision;
+
+    // Write the sign and integer part
+    if ( ((spec->flags & MINBASECLI_FMT_FLAG_LEFT) == 0U) &&
+         ((spec->flags & MINBASECLI_FMT_FLAG_ZERO) == 0U) )
+    {   fmt_pad(out, ' ', pad);   }
+    if (sign != '\0')
+    {   fmt_write(out, &sign, 1U);   }
+    if ( ((spec->flags & MINBASECLI_FMT_FLAG_LEFT) == 0U) &&
+         (spec->flags & MINBASECLI_FMT_FLAG_ZERO) )
+    {   fmt_pad(out, '0', pad);   }
+    fmt_write(out, digits, num_len);
+    fmt_pad(out, '0', exp10);
+
+    // Write the fractional part
+    if (dot)
+    {   fmt_write(out, ".", 1U);   }
+    if (frac_digits > 0)
+    {
+        num_len = minbasecli_u64toa(frac_part, digits,
+                MINBASECLI_MAX_PRINT_SIZE, 10U);
+        fmt_pad(out, '0', frac_digits - (int)(num_len));
+        fmt_write(out, digits, num_len);
+    }
+    fmt_pad(out, '0', precision - frac_digits);
+
+    if (spec->flags & MINBASECLI_FMT_FLAG_LEFT)
+    {   fmt_pad(out, ' ', pad);   }
+}
+
+#endif
+
+#if defined(MINBASECLI_LOG_DEFERRED)
+
+/**
+ * @details
+ * This function writes the record header: the sync byte, the payload length
+ * (set at the end), the format string ID (16 bits offset of the string from
+ * the start of the log section, whose size is checked in setup()) and the
+ * current time in microseconds. The
+ * multi-byte fields use the device byte order (the decoder gets it from the
+ * ELF file).
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::log_begin(t_cli_log_rec* rec, const char* fstr)
+{
+    uint16_t id = (uint16_t)(fstr - __start_minbasecli_log);
+    uint32_t time_us = this->hal_time_us();
+
+    rec->data[0] = MINBASECLI_LOG_SYNC;
+    rec->data[1] = 0U;
+    memcpy(&(rec->data[2]), &id, sizeof(id));
+    memcpy(&(rec->data[4]), &time_us, sizeof(time_us));
+    rec->len = MINBASECLI_LOG_HEADER_SIZE;
+    rec->full = false;
+}
+
+/**
+ * @details
+ * This function writes the argument type tag (with the value size in the
+ * low nibble) followed by the raw value bytes. Once an argument doesn't fit
+ * (one byte is kept for the checksum), the rest of them are discarded too
+ * so the decoder gets the arguments in order.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::log_arg_raw(t_cli_log_rec* rec,
+        const uint8_t tag, const void* value, const size_t value_size)
+{
+    if ( (rec->full) ||
+         ((rec->len + 1U + value_size + 1U) > MINBASECLI_LOG_MAX_RECORD) )
+    {
+        rec->full = true;
+        return;
+    }
+
+    rec->data[rec->len] = (uint8_t)(tag | (value_size & 0x0FU));
+    memcpy(&(rec->data[rec->len + 1U]), value, value_size);
+    rec->len = rec->len + 1U + value_size;
+}
+
+/**
+ * @details
+ * This function writes the string type tag, its length and its characters,
+ * truncated to the free space of the record (at least one character is
+ * required to add it). NULL strings are sent as "(null)".
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::log_arg_str(t_cli_log_rec* rec, const char* str)
+{
+    size_t str_len = 0U;
+    size_t free_len = 0U;
+
+    if (str == NULL)
+    {   str = "(null)";   }
+    str_len = strlen(str);
+
+    // Tag, length and checksum bytes
+    if ( (rec->full) || ((rec->len + 3U) > MINBASECLI_LOG_MAX_RECORD) )
+    {
+        rec->full = true;
+        return;
+    }
+    free_len = MINBASECLI_LOG_MAX_RECORD - rec->len - 3U;
+    if (str_len > free_len)
+    {   str_len = free_len;   }
+    if (str_len > 255U)
+    {   str_len = 255U;   }
+
+    rec->data[rec->len] = MINBASECLI_LOG_TAG_STR;
+    rec->data[rec->len + 1U] = (uint8_t)(str_len);
+    memcpy(&(rec->data[rec->len + 2U]), str, str_len);
+    rec->len = rec->len + 2U + str_len;
+}
+
+/**
+ * @details
+ * This function sets the payload length, appends the payload checksum and
+ * writes the whole record to the transmission buffer, so it is handled as
+ * any other output (output policy and flushes).
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::log_end(t_cli_log_rec* rec)
+{
+    uint8_t checksum = 0U;
+    size_t i = 0U;
+
+    rec->data[1] = (uint8_t)(rec->len - 2U);
+    for (i = 2U; i < rec->len; i++)
+    {   checksum = (uint8_t)(checksum + rec->data[i]);   }
+    rec->data[rec->len] = checksum;
+    rec->len = rec->len + 1U;
+
+    tx_write(rec->data, rec->len);
+}
+
+#endif
+
+/**
+ * @details
+ * This function set t_result attributes to an empty command without
+ * arguments. The arguments arrays are not cleared, as the tokenizer sets
+ * each argument below argc (it is called for each line and on each poll).
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::set_default_result(t_result* cli_result)
+{
+    cli_result->cmd = EMPTY_STR;
+    cli_result->cmd_len = 0U;
+    cli_result->argc = 0;
+}
+
+/**
+ * @details
+ * This function checks if the last received command is one of the added
+ * inside CLI component to be handle through a callback (looking for it in
+ * the hash index), and call to the corresponding callback for it.
+ * If the command is not found there (or multiple words commands have been
+ * added), the commands trie is used to get the longest added commands path
+ * that matches the received words (allowing unique abbreviations), and the
+ * callback receives just the words that follows that path as arguments.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::dispatch_cmd()
+{
+    t_cmd_cb_info* cmd_cb_info = NULL;
+    size_t cmd_len = 0U;
+    uint32_t hash = 0U;
+    uint8_t words_used = 1U;
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+    const t_cmd_entry* table_entry = NULL;
+#endif
+#if defined(MINBASECLI_CMD_STATS)
+    uint32_t t_start = 0U;
+#endif
+
+    // If no custom "help" command is set
+    if (use_builtin_help_cmd)
+    {
+        // For "help" command, call the builtin "help" function
+        if ( (cli_result.cmd_len == sizeof(CMD_HELP) - 1U) &&
+             (memcmp(cli_result.cmd, CMD_HELP, sizeof(CMD_HELP) - 1U) == 0) )
+        {
+            cmd_help(cli_result.argc, cli_result.argv);
+            return true;
+        }
+    }
+
+#if defined(MINBASECLI_CMD_STATS)
+    // For "stats" command, call the builtin "stats" function if no custom
+    // one is set
+    if ( use_builtin_stats_cmd &&
+         (cli_result.cmd_len == sizeof(CMD_STATS) - 1U) &&
+         (memcmp(cli_result.cmd, CMD_STATS, sizeof(CMD_STATS) - 1U) == 0) )
+    {
+        cmd_stats(cli_result.argc, cli_result.argv);
+        return true;
+    }
+#endif
+
+    hash = cmd_hash(cli_result.cmd, &cmd_len);
+
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+    // Check if the command is in the constant command table
+    table_entry = cmd_table_find(cli_result.cmd, hash);
+    if (table_entry != NULL)
+    {
+        MINBASECLI_TRACE_CB_ENTER_POINT(this, cli_result.argc, cli_result.cmd);
+        table_entry->callback(this, cli_result.argc, cli_result.argv);
+        MINBASECLI_TRACE_CB_EXIT_POINT(this, cli_result.argc, cli_result.cmd);
+        return true;
+    }
+#endif
+
+#if defined(MINBASECLI_CMD_TRIE)
+    // Check if the command is added in the callback handle list, or get the
+    // longest added commands path that matches the received words
+    if (cmd_trie_multiword == false)
+    {   cmd_cb_info = cmd_find(cli_result.cmd, cmd_len, hash);   }
+    if (cmd_cb_info == NULL)
+    {
+        cmd_cb_info = cmd_trie_find(cli_result.cmd, cli_result.argc,
+                cli_result.argv, &words_used, t_cmd_index_tag());
+    }
+#else
+    // Check if the command is added in the callback handle list
+    cmd_cb_info = cmd_find(cli_result.cmd, cmd_len, hash);
+#endif
+    if (cmd_cb_info == NULL)
+    {   return false;   }
+
+#if defined(MINBASECLI_CMD_ASYNC)
+    // Queue asynchronous commands to be executed by a worker thread
+    if (cmd_cb_info->async)
+    {
+        async_submit(cmd_cb_info, cli_result.argc - (words_used - 1U),
+                &(cli_result.argv[words_used - 1U]));
+        return true;
+    }
+#endif
+
+    MINBASECLI_TRACE_CB_ENTER_POINT(this, cli_result.argc, cli_result.cmd);
+#if defined(MINBASECLI_CMD_STATS)
+    t_start = this->hal_time_us();
+#endif
+
+    // Call to command callback (commands path words are not arguments)
+    cmd_cb_info->callback(this, cli_result.argc - (words_used - 1U),
+            &(cli_result.argv[words_used - 1U]));
+
+#if defined(MINBASECLI_CMD_STATS)
+    cmd_stats_record(&(cmd_cb_info->stats), this->hal_time_us() - t_start);
+#endif
+    MINBASECLI_TRACE_CB_EXIT_POINT(this, cli_result.argc, cli_result.cmd);
+
+    return true;
+}
+
+/**
+ * @details
+ * This function computes the 32 bits FNV-1a hash of the provided command
+ * string, that is used as key of the added commands hash index, getting also
+ * the number of characters of the command in the same pass.
+ */
+template <class HAL, class CFG>
+uint32_t MINBASECLI_CORE<HAL, CFG>::cmd_hash(const char* command,
+        size_t* command_len)
+{
+    uint32_t hash = FNV1A_32_OFFSET_BASIS;
+    size_t i = 0U;
+
+    while (command[i] != '\0')
+    {
+        hash = (hash ^ (uint8_t)(command[i])) * FNV1A_32_PRIME;
+        i = i + 1U;
+    }
+    *command_len = i;
+
+    return hash;
+}
+
+/**
+ * @details
+ * This function compares the lengths of the added command text and the
+ * provided one, and then their characters (reading them from the program
+ * memory if the added command text is stored there).
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::cmd_equal(const t_cmd_cb_info* cmd_cb_info,
+        const char* command, const size_t command_len)
+{
+    if (cmd_cb_info->command_len != command_len)
+    {   return false;   }
+
+#if defined(MINBASECLI_CMD_PROGMEM)
+    if (cmd_cb_info->progmem)
+    {   return (memcmp_P(command, cmd_cb_info->command, command_len) == 0);   }
+#endif
+
+    return (memcmp(command, cmd_cb_info->command, command_len) == 0);
+}
+
+/**
+ * @details
+ * This function calls to the hash index search of the CLI configuration.
+ */
+template <class HAL, class CFG>
+typename MINBASECLI_CORE<HAL, CFG>::t_cmd_cb_info*
+MINBASECLI_CORE<HAL, CFG>::cmd_find(const char* command,
+        const size_t command_len, const uint32_t hash)
+{
+    return cmd_find(command, command_len, hash, t_cmd_index_tag());
+}
+
+/**
+ * @details
+ * This function probes the hash index slots starting from the one that
+ * corresponds to the provided hash, until an empty slot is reached (command
+ * not added) or an added command with the same hash and text is found.
+ */
+template <class HAL, class CFG>
+template <class TAG>
+typename MINBASECLI_CORE<HAL, CFG>::t_cmd_cb_info*
+MINBASECLI_CORE<HAL, CFG>::cmd_find(const char* command,
+        const size_t command_len, const uint32_t hash, TAG)
+{
+    t_cmd_cb_info* cmd_cb_info = NULL;
+    uint32_t slot = hash & (CFG::CMD_HASH_SIZE - 1U);
+
+    while (cmd_hash_index[slot] != 0U)
+    {
+        cmd_cb_info = &(added_commands[cmd_hash_index[slot] - 1U]);
+        if ( (cmd_cb_info->hash == hash) &&
+             cmd_equal(cmd_cb_info, command, command_len) )
+        {   return cmd_cb_info;   }
+        slot = (slot + 1U) & (CFG::CMD_HASH_SIZE - 1U);
+    }
+
+    return NULL;
+}
+
+/**
+ * @details
+ * This function is the hash index search of a configuration that can't add
+ * commands, so no command is found.
+ */
+template <class HAL, class CFG>
+typename MINBASECLI_CORE<HAL, CFG>::t_cmd_cb_info*
+MINBASECLI_CORE<HAL, CFG>::cmd_find(const char* command,
+        const size_t command_len, const uint32_t hash,
+        MINBASECLI_BOOL_TAG<false> tag)
+{
+    return NULL;
+}
+
+/**
+ * @details
+ * This function inserts the command position (plus one) in the first free
+ * slot of the hash index (linear probing), and inserts the command in the
+ * commands trie.
+ */
+template <class HAL, class CFG>
+template <class TAG>
+void MINBASECLI_CORE<HAL, CFG>::cmd_index_insert(const uint8_t cmd,
+        const char* command, TAG tag)
+{
+    uint32_t slot = added_commands[cmd].hash & (CFG::CMD_HASH_SIZE - 1U);
+
+    while (cmd_hash_index[slot] != 0U)
+    {   slot = (slot + 1U) & (CFG::CMD_HASH_SIZE - 1U);   }
+    cmd_hash_index[slot] = cmd + 1U;
+
+#if defined(MINBASECLI_CMD_TRIE)
+    cmd_trie_insert(cmd, tag);
+    if (strchr(command, ' ') != NULL)
+    {   cmd_trie_multiword = true;   }
+#endif
+}
+
+/**
+ * @details
+ * This function is the indexes insertion of a configuration that can't add
+ * commands, so it does nothing (no command is ever registered).
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::cmd_index_insert(const uint8_t cmd,
+        const char* command, MINBASECLI_BOOL_TAG<false> tag)
+{}
+
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+
+/**
+ * @details
+ * This function gets the bucket of the provided hash and its displacement
+ * value, that gives the only table slot where the command can be, and then
+ * compares the command text stored there.
+ */
+template <class HAL, class CFG>
+const typename MINBASECLI_CORE<HAL, CFG>::t_cmd_entry*
+MINBASECLI_CORE<HAL, CFG>::cmd_table_find(const char* command,
+        const uint32_t hash)
+{
+    uint32_t bucket = 0U;
+    uint32_t slot = 0U;
+    uint8_t entry = 0U;
+
+    // Check if a table has been set
+    if (cmd_table.entries == NULL)
+    {   return NULL;   }
+
+    bucket = minbasecli_cmd_table_bucket(hash, cmd_table.buckets_mask);
+    slot = minbasecli_cmd_table_slot(hash, cmd_table.disp[bucket],
+            cmd_table.slots_mask);
+    entry = cmd_table.slots[slot];
+    if (entry == 0U)
+    {   return NULL;   }
+    if (strcmp(command, cmd_table.entries[entry - 1U].command) != 0)
+    {   return NULL;   }
+
+    return &(cmd_table.entries[entry - 1U]);
+}
+
+#endif
+
+/**
+ * @details
+ * This function checks if any command has been added or if a constant
+ * command table has been set.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::any_cmd()
+{
+#if defined(MINBASECLI_CMD_TABLE_SUPPORT)
+    if (cmd_table.num_entries != 0U)
+    {   return true;   }
+#endif
+
+    return (num_added_commands != 0U);
+}
+
+/**
+ * @details
+ * This function prints the added command text and description, reading them
+ * from the program memory if they are stored there.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::print_cmd_info(const t_cmd_cb_info* cmd_cb_info)
+{
+#if defined(MINBASECLI_CMD_PROGMEM)
+    if (cmd_cb_info->progmem)
+    {
+        printstr_P(cmd_cb_info->command, cmd_cb_info->command_len);
+        printstr(" - ", 3U);
+        printstr_P(cmd_cb_info->description, cmd_cb_info->description_len);
+        printstr("\n", 1U);
+        return;
+    }
+#endif
+
+    printstr(cmd_cb_info->command, cmd_cb_info->command_len);
+    printstr(" - ", 3U);
+    printstr(cmd_cb_info->description, cmd_cb_info->description_len);
+    printstr("\n", 1U);
+}
+
+#if defined(MINBASECLI_CMD_STATS)
+
+/**
+ * @details
+ * This function counts the call, updates the total, min and max times and
+ * increases the histogram bucket of the time (the bucket bounds are powers
+ * of four, so it is got with shifts). The counters saturate instead of
+ * wrapping around.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::cmd_stats_record(t_cli_cmd_stats* stats,
+        const uint32_t elapsed_us)
+{
+    uint32_t t = elapsed_us;
+    uint8_t bucket = 0U;
+
+    if (stats->calls == UINT32_MAX)
+    {   return;   }
+
+    if ( (stats->calls == 0U) || (elapsed_us < stats->min_us) )
+    {   stats->min_us = elapsed_us;   }
+    if (elapsed_us > stats->max_us)
+    {   stats->max_us = elapsed_us;   }
+    stats->calls = stats->calls + 1U;
+    stats->total_us = stats->total_us + elapsed_us;
+
+    while ( (t >= 4U) && (bucket < (MINBASECLI_CMD_STATS_BUCKETS - 1U)) )
+    {
+        t = t >> 2;
+        bucket = bucket + 1U;
+    }
+    stats->histogram[bucket] = stats->histogram[bucket] + 1U;
+}
+
+/**
+ * @details
+ * This function prints the added command text (reading it from the program
+ * memory if it is stored there), its calls statistics and the histogram
+ * buckets counters.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::print_cmd_stats(
+        const t_cmd_cb_info* cmd_cb_info)
+{
+    const t_cli_cmd_stats* stats = &(cmd_cb_info->stats);
+    uint32_t avg_us = 0U;
+    uint8_t i = 0U;
+
+#if defined(MINBASECLI_CMD_PROGMEM)
+    if (cmd_cb_info->progmem)
+    {   printstr_P(cmd_cb_info->command, cmd_cb_info->command_len);   }
+    else
+#endif
+    {   printstr(cmd_cb_info->command, cmd_cb_info->command_len);   }
+
+    if (stats->calls != 0U)
+    {   avg_us = (uint32_t)(stats->total_us / stats->calls);   }
+    this->printf(" - calls: %lu, total: %llu, min: %lu, avg: %lu, max: %lu\n",
+            (unsigned long)(stats->calls),
+            (unsigned long long)(stats->total_us),
+            (unsigned long)(stats->min_us), (unsigned long)(avg_us),
+            (unsigned long)(stats->max_us));
+
+    // Histogram buckets counters with their times bounds
+    printstr("   ", 3U);
+    for (i = 0U; i < (MINBASECLI_CMD_STATS_BUCKETS - 1U); i++)
+    {
+        this->printf(" <%lu:%lu", (unsigned long)(4UL << (2U * i)),
+                (unsigned long)(stats->histogram[i]));
+    }
+    this->printf(" >=%lu:%lu\n", (unsigned long)(1UL << (2U * i)),
+            (unsigned long)(stats->histogram[i]));
+}
+
+#endif
+
+#if defined(MINBASECLI_CMD_ASYNC)
+
+/**
+ * @details
+ * This function gets a free command execution (just the CLI thread uses the
+ * free ones, so it is filled without the lock), copies the command and
+ * arguments texts into it, and then queues it with the next tag and wakes up
+ * a worker thread. The command is rejected if there is no free execution.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::async_submit(t_cmd_cb_info* cmd_cb_info,
+        int argc, char* argv[])
+{
+    t_async_job* job = NULL;
+    size_t line_len = 0U;
+    size_t arg_len = 0U;
+    uint32_t tag = 0U;
+
+    // Get a free command execution
+    pthread_mutex_lock(&async_mutex);
+    for (size_t i = 0U; i < MINBASECLI_ASYNC_JOBS; i++)
+    {
+        if (async_jobs[i].state == ASYNC_JOB_FREE)
+        {
+            job = &(async_jobs[i]);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&async_mutex);
+    if (job == NULL)
+    {
+        this->printf("Asynchronous commands queue is full.\n");
+        return;
+    }
+
+    // Copy the command and arguments texts
+    line_len = cli_result.cmd_len + 1U;
+    memcpy(job->line, cli_result.cmd, line_len);
+    job->argc = 0;
+    for (int i = 0; i < argc; i++)
+    {
+        arg_len = strlen(argv[i]) + 1U;
+        if ((line_len + arg_len) > CFG::MAX_READ_SIZE)
+        {   break;   }
+        memcpy(&(job->line[line_len]), argv[i], arg_len);
+        job->argv[i] = &(job->line[line_len]);
+        job->argc = job->argc + 1;
+        line_len = line_len + arg_len;
+    }
+    job->cmd_cb_info = cmd_cb_info;
+    job->out_len = 0U;
+    job->out_discarded = 0U;
+
+    // Queue the command execution
+    pthread_mutex_lock(&async_mutex);
+    tag = async_next_tag;
+    async_next_tag = async_next_tag + 1U;
+    job->tag = tag;
+    job->state = ASYNC_JOB_QUEUED;
+    pthread_cond_signal(&async_cond);
+    pthread_mutex_unlock(&async_mutex);
+
+    this->printf("[%lu] queued\n", (unsigned long)(tag));
+}
+
+/**
+ * @details
+ * This function sends the response of each ended command that can be sent,
+ * writing the command tag at the start of each of its output lines, then
+ * the discarded output bytes (if any) and the "[tag] done" line. The
+ * command callback time is added to the command statistics here, so they
+ * are just modified by the CLI thread.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::async_emit()
+{
+    t_async_job* job = async_ready(NULL);
+    const char* line_end = NULL;
+    size_t line_start = 0U;
+    size_t line_len = 0U;
+
+    while (job != NULL)
+    {
+        // Send each output line with the command tag
+        line_start = 0U;
+        while (line_start < job->out_len)
+        {
+            line_len = job->out_len - line_start;
+            line_end = (const char*)(memchr(&(job->out[line_start]), '\n',
+                    line_len));
+            if (line_end != NULL)
+            {   line_len = (size_t)(line_end - &(job->out[line_start]));   }
+            this->printf("[%lu] ", (unsigned long)(job->tag));
+            printstr(&(job->out[line_start]), line_len);
+            printstr("\n", 1U);
+            line_start = line_start + line_len + 1U;
+        }
+        if (job->out_discarded > 0U)
+        {
+            this->printf("[%lu] (%lu output bytes discarded)\n",
+                    (unsigned long)(job->tag),
+                    (unsigned long)(job->out_discarded));
+        }
+        this->printf("[%lu] done\n", (unsigned long)(job->tag));
+#if defined(MINBASECLI_CMD_STATS)
+        cmd_stats_record(&(job->cmd_cb_info->stats), job->elapsed_us);
+#endif
+
+        // Release the command execution
+        pthread_mutex_lock(&async_mutex);
+        job->state = ASYNC_JOB_FREE;
+        pthread_mutex_unlock(&async_mutex);
+
+        tx_response_end();
+        job = async_ready(NULL);
+    }
+}
+
+/**
+ * @details
+ * This function looks for the first ended command (lowest end sequence
+ * number) with the COMPLETION order, or checks if the oldest pending
+ * command (lowest tag) has ended with the SUBMISSION order. The tags and
+ * sequence numbers are compared by their difference, so they can wrap
+ * around.
+ */
+template <class HAL, class CFG>
+typename MINBASECLI_CORE<HAL, CFG>::t_async_job*
+MINBASECLI_CORE<HAL, CFG>::async_ready(bool* running)
+{
+    t_async_job* job = NULL;
+    t_async_job* first_done = NULL;
+    t_async_job* oldest = NULL;
+
+    if (running != NULL)
+    {   *running = false;   }
+
+    pthread_mutex_lock(&async_mutex);
+    for (size_t i = 0U; i < MINBASECLI_ASYNC_JOBS; i++)
+    {
+        job = &(async_jobs[i]);
+        if (job->state == ASYNC_JOB_FREE)
+        {   continue;   }
+        if (job->state == ASYNC_JOB_DONE)
+        {
+            if ( (first_done == NULL) ||
+                 ((int32_t)(job->done_seq - first_done->done_seq) < 0) )
+            {   first_done = job;   }
+        }
+        else if (running != NULL)
+        {   *running = true;   }
+        if ( (oldest == NULL) || ((int32_t)(job->tag - oldest->tag) < 0) )
+        {   oldest = job;   }
+    }
+    if ( (async_order == MINBASECLI_ASYNC_ORDER_SUBMISSION) &&
+         (oldest != NULL) )
+    {
+        first_done = NULL;
+        if (oldest->state == ASYNC_JOB_DONE)
+        {   first_done = oldest;   }
+    }
+    pthread_mutex_unlock(&async_mutex);
+
+    return first_done;
+}
+
+/**
+ * @details
+ * This function loops, until the worker threads are requested to stop,
+ * getting the oldest queued command (or waiting to be woken up when there is
+ * none), and calling to its callback with the output of the thread
+ * redirected to the command output buffer. Then it marks the command as
+ * ended with the next end sequence number, so the CLI thread sends its
+ * response.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::async_worker()
+{
+    t_async_job* job = NULL;
+#if defined(MINBASECLI_CMD_STATS)
+    uint32_t t_start = 0U;
+#endif
+
+    pthread_mutex_lock(&async_mutex);
+    while (async_stop == false)
+    {
+        // Get the oldest queued command
+        job = NULL;
+        for (size_t i = 0U; i < MINBASECLI_ASYNC_JOBS; i++)
+        {
+            if (async_jobs[i].state != ASYNC_JOB_QUEUED)
+            {   continue;   }
+            if ( (job == NULL) ||
+                 ((int32_t)(async_jobs[i].tag - job->tag) < 0) )
+            {   job = &(async_jobs[i]);   }
+        }
+        if (job == NULL)
+        {
+            pthread_cond_wait(&async_cond, &async_mutex);
+            continue;
+        }
+        job->state = ASYNC_JOB_RUNNING;
+        pthread_mutex_unlock(&async_mutex);
+
+        // Call to command callback
+        async_job = job;
+        MINBASECLI_TRACE_CB_ENTER_POINT(this, job->argc, job->line);
+#if defined(MINBASECLI_CMD_STATS)
+        t_start = this->hal_time_us();
+#endif
+        job->cmd_cb_info->callback(this, job->argc, job->argv);
+#if defined(MINBASECLI_CMD_STATS)
+        job->elapsed_us = this->hal_time_us() - t_start;
+#endif
+        MINBASECLI_TRACE_CB_EXIT_POINT(this, job->argc, job->line);
+        async_job = NULL;
+
+        // Set the command as ended
+        pthread_mutex_lock(&async_mutex);
+        job->done_seq = async_next_done_seq;
+        async_next_done_seq = async_next_done_seq + 1U;
+        job->state = ASYNC_JOB_DONE;
+    }
+    pthread_mutex_unlock(&async_mutex);
+}
+
+/**
+ * @details
+ * This function calls to the worker thread loop of the CLI object.
+ */
+template <class HAL, class CFG>
+void* MINBASECLI_CORE<HAL, CFG>::async_worker_thread(void* cli)
+{
+    ((MINBASECLI_CORE<HAL, CFG>*)(cli))->async_worker();
+    return NULL;
+}
+
+/**
+ * @details
+ * This function copies the part of the block that fits in the command
+ * output buffer and counts the discarded bytes.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::async_write(const uint8_t* data,
+        const size_t data_len)
+{
+    size_t store_len = MINBASECLI_ASYNC_OUT_SIZE - async_job->out_len;
+
+    if (store_len > data_len)
+    {   store_len = data_len;   }
+    memcpy(&(async_job->out[async_job->out_len]), data, store_len);
+    async_job->out_len = async_job->out_len + store_len;
+    async_job->out_discarded = async_job->out_discarded +
+            (uint32_t)(data_len - store_len);
+}
+
+#endif
+
+#if defined(MINBASECLI_CMD_TRIE)
+
+/**
+ * @details
+ * This function returns the requested character of the added command text,
+ * reading it from the program memory if the text is stored there.
+ */
+template <class HAL, class CFG>
+char MINBASECLI_CORE<HAL, CFG>::cmd_text_char(const uint8_t cmd,
+        const uint8_t pos)
+{
+#if defined(MINBASECLI_CMD_PROGMEM)
+    if (added_commands[cmd].progmem)
+    {   return (char)(pgm_read_byte(added_commands[cmd].command + pos));   }
+#endif
+
+    return added_commands[cmd].command[pos];
+}
+
+/**
+ * @details
+ * This function returns the requested character of the node label, that is
+ * a substring of one of the added commands texts.
+ */
+template <class HAL, class CFG>
+template <class TAG>
+char MINBASECLI_CORE<HAL, CFG>::cmd_trie_label_char(const t_cmd_trie_idx node,
+        const uint8_t pos, TAG)
+{
+    return cmd_text_char(cmd_trie[node].cmd, cmd_trie[node].label_start + pos);
+}
+
+/**
+ * @details
+ * This function walks the trie from the root following the command text.
+ * When the text diverges in the middle of a node label, the node is split
+ * in two (the node keeps the common part and a new child node gets the rest
+ * of the label and the node children), and then a new leaf node is appended
+ * as last child with the rest of the command text. Each insertion creates
+ * two nodes at most.
+ */
+template <class HAL, class CFG>
+template <class TAG>
+bool MINBASECLI_CORE<HAL, CFG>::cmd_trie_insert(const uint8_t cmd, TAG tag)
+{
+    t_cmd_trie_idx node = 0U;
+    t_cmd_trie_idx child = 0U;
+    t_cmd_trie_idx last = 0U;
+    uint8_t pos = 0U;
+    uint8_t len = added_commands[cmd].command_len;
+    uint8_t k = 0U;
+
+    // Check if there is enough space for the nodes of a new command
+    if (cmd_trie_num_nodes + 2U > CFG::CMD_TRIE_NODES)
+    {   return false;   }
+
+    while (pos < len)
+    {
+        // Check for a child with the next command character, if there is no
+        // one, append a new leaf node with the rest of the command
+        child = cmd_trie_child(node, cmd_text_char(cmd, pos), tag);
+        if (child == 0U)
+        {
+            child = cmd_trie_num_nodes;
+            cmd_trie_num_nodes = cmd_trie_num_nodes + 1U;
+            cmd_trie[child].cmd = cmd;
+            cmd_trie[child].label_start = pos;
+            cmd_trie[child].label_len = len - pos;
+            cmd_trie[child].terminal = cmd + 1U;
+            cmd_trie[child].child = 0U;
+            cmd_trie[child].sibling = 0U;
+            if (cmd_trie[node].child == 0U)
+            {   cmd_trie[node].child = child;   }
+            else
+            {
+                last = cmd_trie[node].child;
+                while (cmd_trie[last].sibling != 0U)
+                {   last = cmd_trie[last].sibling;   }
+                cmd_trie[last].sibling = child;
+            }
+            return true;
+        }
+
+        // Get number of common characters with the child label
+        k = 1U;
+        while ( (k < cmd_trie[child].label_len) && (pos + k < len) &&
+                (cmd_trie_label_char(child, k, tag) ==
+                 cmd_text_char(cmd, pos + k)) )
+        {   k = k + 1U;   }
+
+        // Split the child node if the command diverges inside its label
+        if (k < cmd_trie[child].label_len)
+        {
+            t_cmd_trie_idx tail = cmd_trie_num_nodes;
+            cmd_trie_num_nodes = cmd_trie_num_nodes + 1U;
+            cmd_trie[tail].cmd = cmd_trie[child].cmd;
+            cmd_trie[tail].label_start = cmd_trie[child].label_start + k;
+            cmd_trie[tail].label_len = cmd_trie[child].label_len - k;
+            cmd_trie[tail].terminal = cmd_trie[child].terminal;
+            cmd_trie[tail].child = cmd_trie[child].child;
+            cmd_trie[tail].sibling = 0U;
+            cmd_trie[child].label_len = k;
+            cmd_trie[child].terminal = 0U;
+            cmd_trie[child].child = tail;
+        }
+
+        node = child;
+        pos = pos + k;
+    }
+
+    // The command ends in an existing node
+    cmd_trie[node].terminal = cmd + 1U;
+
+    return true;
+}
+
+/**
+ * @details
+ * This function loops through the node children checking the first
+ * character of their labels.
+ */
+template <class HAL, class CFG>
+template <class TAG>
+typename MINBASECLI_CORE<HAL, CFG>::t_cmd_trie_idx
+MINBASECLI_CORE<HAL, CFG>::cmd_trie_child(const t_cmd_trie_idx node,
+        const char c, TAG tag)
+{
+    t_cmd_trie_idx child = cmd_trie[node].child;
+
+    while (child != 0U)
+    {
+        if (cmd_trie_label_char(child, 0U, tag) == c)
+        {   return child;   }
+        child = cmd_trie[child].sibling;
+    }
+
+    return 0U;
+}
+
+/**
+ * @details
+ * This function checks the next character of the current node label, or
+ * the node children labels if the whole node label has been matched.
+ */
+template <class HAL, class CFG>
+template <class TAG>
+bool MINBASECLI_CORE<HAL, CFG>::cmd_trie_step(t_cmd_trie_idx* node,
+        uint8_t* offset, const char c, TAG tag)
+{
+    t_cmd_trie_idx child = 0U;
+
+    if (*offset < cmd_trie[*node].label_len)
+    {
+        if (cmd_trie_label_char(*node, *offset, tag) != c)
+        {   return false;   }
+        *offset = *offset + 1U;
+        return true;
+    }
+
+    child = cmd_trie_child(*node, c, tag);
+    if (child == 0U)
+    {   return false;   }
+    *node = child;
+    *offset = 1U;
+
+    return true;
+}
+
+/**
+ * @details
+ * This function advances the trie position through the rest of the current
+ * word while there is just one possible continuation. A word ends before a
+ * space character or at the end of a command. If the received word matches
+ * a whole word it is not ambiguous even if it is also the prefix of others
+ * (i.e. "net" with "net" and "netstat" commands added).
+ */
+template <class HAL, class CFG>
+template <class TAG>
+bool MINBASECLI_CORE<HAL, CFG>::cmd_trie_complete_word(t_cmd_trie_idx* node,
+        uint8_t* offset, TAG tag)
+{
+    t_cmd_trie_idx child = 0U;
+    t_cmd_trie_idx next = 0U;
+    uint8_t num_next = 0U;
+    bool word_end = false;
+    bool completing = false;
+
+    while (true)
+    {
+        // Inside a node label there is just one continuation
+        if (*offset < cmd_trie[*node].label_len)
+        {
+            if (cmd_trie_label_char(*node, *offset, tag) == ' ')
+            {   return true;   }
+            *offset = *offset + 1U;
+            completing = true;
+            continue;
+        }
+
+        // At the end of a node label, check how the word can continue
+        word_end = (cmd_trie[*node].terminal != 0U);
+        num_next = 0U;
+        child = cmd_trie[*node].child;
+        while (child != 0U)
+        {
+            if (cmd_trie_label_char(child, 0U, tag) == ' ')
+            {   word_end = true;   }
+            else
+            {
+                next = child;
+                num_next = num_next + 1U;
+            }
+            child = cmd_trie[child].sibling;
+        }
+        if ( word_end && ((num_next == 0U) || (completing == false)) )
+        {   return true;   }
+        if ( word_end || (num_next != 1U) )
+        {   return false;   }
+        *node = next;
+        *offset = 0U;
+        completing = true;
+    }
+}
+
+/**
+ * @details
+ * This function matches each received word through the trie (completing
+ * unique abbreviations) and a space character between words, storing the
+ * last matched commands path that is an added command, until a word doesn't
+ * match or there are no more words.
+ */
+template <class HAL, class CFG>
+template <class TAG>
+typename MINBASECLI_CORE<HAL, CFG>::t_cmd_cb_info*
+MINBASECLI_CORE<HAL, CFG>::cmd_trie_find(char* cmd, int argc, char* argv[],
+        uint8_t* words_used, TAG tag)
+{
+    t_cmd_cb_info* cmd_cb_info = NULL;
+    t_cmd_trie_idx node = 0U;
+    uint8_t offset = 0U;
+    char* word = cmd;
+
+    for (int i = 0; i <= argc; i++)
+    {
+        // Get the word and check the space character between words
+        if (i > 0)
+        {
+            word = argv[i - 1];
+            if (cmd_trie_step(&node, &offset, ' ', tag) == false)
+            {   break;   }
+        }
+
+        // Match the word characters and complete it
+        while (*word != '\0')
+        {
+            if (cmd_trie_step(&node, &offset, *word, tag) == false)
+            {   return cmd_cb_info;   }
+            word = word + 1;
+        }
+        if (cmd_trie_complete_word(&node, &offset, tag) == false)
+        {   break;   }
+
+        // Store the commands path if it is an added command
+        if ( (offset == cmd_trie[node].label_len) &&
+             (cmd_trie[node].terminal != 0U) )
+        {
+            cmd_cb_info = &(added_commands[cmd_trie[node].terminal - 1U]);
+            *words_used = (uint8_t)(i + 1);
+        }
+    }
+
+    return cmd_cb_info;
+}
+
+/**
+ * @details
+ * This function prints the command that ends in the node (if any) and then
+ * the commands under each node child, recursively.
+ */
+template <class HAL, class CFG>
+template <class TAG>
+void MINBASECLI_CORE<HAL, CFG>::cmd_trie_print(const t_cmd_trie_idx node,
+        TAG tag)
+{
+    t_cmd_trie_idx child = cmd_trie[node].child;
+
+    if (cmd_trie[node].terminal != 0U)
+    {   print_cmd_info(&(added_commands[cmd_trie[node].terminal - 1U]));   }
+    while (child != 0U)
+    {
+        cmd_trie_print(child, tag);
+        child = cmd_trie[child].sibling;
+    }
+}
+
+/**
+ * @details
+ * This function matches the provided commands path words (separated by a
+ * space) through the trie to get the node where the path ends, and prints
+ * all commands under it. If the path ends in a whole word, the commands that
+ * just starts with the same characters are not printed ("help net" doesn't
+ * show "netstat", but "help ne" does).
+ */
+template <class HAL, class CFG>
+template <class TAG>
+bool MINBASECLI_CORE<HAL, CFG>::cmd_trie_help(int argc, char* argv[], TAG tag)
+{
+    t_cmd_trie_idx node = 0U;
+    t_cmd_trie_idx child = 0U;
+    uint8_t offset = 0U;
+    char* word = NULL;
+    bool word_end = false;
+
+    for (int i = 0; i < argc; i++)
+    {
+        word = argv[i];
+        if ( (i > 0) && (cmd_trie_step(&node, &offset, ' ', tag) == false) )
+        {   return false;   }
+        while (*word != '\0')
+        {
+            if (cmd_trie_step(&node, &offset, *word, tag) == false)
+            {   return false;   }
+            word = word + 1;
+        }
+    }
+
+    // Check if the path ends in a whole word at the end of the node label
+    if (offset == cmd_trie[node].label_len)
+    {
+        word_end = (cmd_trie[node].terminal != 0U);
+        child = cmd_trie[node].child;
+        while (child != 0U)
+        {
+            if (cmd_trie_label_char(child, 0U, tag) == ' ')
+            {   word_end = true;   }
+            child = cmd_trie[child].sibling;
+        }
+    }
+    if (word_end == false)
+    {
+        cmd_trie_print(node, tag);
+        return true;
+    }
+
+    // Print just the commands that continues with a new word
+    if (cmd_trie[node].terminal != 0U)
+    {   print_cmd_info(&(added_commands[cmd_trie[node].terminal - 1U]));   }
+    child = cmd_trie[node].child;
+    while (child != 0U)
+    {
+        if (cmd_trie_label_char(child, 0U, tag) == ' ')
+        {   cmd_trie_print(child, tag);   }
+        child = cmd_trie[child].sibling;
+    }
+
+    return true;
+}
+
+/**
+ * @details
+ * This function is the commands trie search of a configuration that can't
+ * add commands, so no command is found.
+ */
+template <class HAL, class CFG>
+typename MINBASECLI_CORE<HAL, CFG>::t_cmd_cb_info*
+MINBASECLI_CORE<HAL, CFG>::cmd_trie_find(char* cmd, int argc, char* argv[],
+        uint8_t* words_used, MINBASECLI_BOOL_TAG<false> tag)
+{
+    return NULL;
+}
+
+/**
+ * @details
+ * This function is the commands path help of a configuration that can't add
+ * commands, so no command is printed.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::cmd_trie_help(int argc, char* argv[],
+        MINBASECLI_BOOL_TAG<false> tag)
+{
+    return false;
+}
+
+#endif
+
+/**
+ * @details
+ * This function check if CLI interface initialized flag is off.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::iface_is_not_initialized()
+{
+    return (this->initialized == false);
+}
+
+/**
+ * @details
+ * This function just return the current number of bytes received by
+ * iface_read_data().
+ */
+template <class HAL, class CFG>
+uint32_t MINBASECLI_CORE<HAL, CFG>::get_received_bytes()
+{
+    return (this->received_bytes);
+}
+
+/**
+ * @details
+ * This function get chunks of received bytes from the CLI interface into the
+ * reception buffer array and search them in a single pass for an End-Of-Line
+ * character. It differentiates between CR, LF and CRLF (also when the CR and
+ * LF are received in different chunks), and get rid off this characters from
+ * the read buffer. The data received after the End-Of-Line is kept in the
+ * buffer and it is moved to the buffer start in the next call (the completed
+ * line is in use until then).
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::iface_read_data(char* rx_read,
+        const size_t rx_read_size)
+{
+    size_t read_bytes = 0U;
+    size_t i = 0U;
+
+    // Discard the last completed line
+    if (this->rx_line_next > 0U)
+    {
+        this->rx_read_len = this->rx_read_len - this->rx_line_next;
+        memmove(rx_read, &(rx_read[this->rx_line_next]), this->rx_read_len);
+        this->rx_line_next = 0U;
+        this->received_bytes = 0;
+    }
+
+    while (true)
+    {
+        // Discard the LF of a CRLF that was split in different chunks
+        if ( this->rx_skip_lf && (this->rx_read_len > 0U) )
+        {
+            this->rx_skip_lf = false;
+            if (rx_read[0] == '\n')
+            {
+                this->rx_read_len = this->rx_read_len - 1U;
+                memmove(rx_read, &(rx_read[1]), this->rx_read_len);
+            }
+        }
+
+        // Search for CR or LF in the data that has not been checked yet
+        for (i = this->received_bytes; i < this->rx_read_len; i++)
+        {
+            if ( (rx_read[i] == '\r') || (rx_read[i] == '\n') )
+            {   break;   }
+        }
+        this->received_bytes = i;
+
+        // Check for End-Of-Line
+        if (i < this->rx_read_len)
+        {
+            this->rx_line_next = i + 1U;
+
+            // Check for CRLF (or a CR at the end of the received data)
+            if (rx_read[i] == '\r')
+            {
+                if (this->rx_line_next == this->rx_read_len)
+                {   this->rx_skip_lf = true;   }
+                else if (rx_read[this->rx_line_next] == '\n')
+                {   this->rx_line_next = this->rx_line_next + 1U;   }
+            }
+
+            rx_read[i] = '\0';
+            MINBASECLI_TRACE_LINE_POINT(this, i);
+            return true;
+        }
+
+        // Check for read buffer full
+        if (this->rx_read_len >= rx_read_size - 1U)
+        {
+            rx_read[rx_read_size - 1U] = '\0';
+            this->rx_line_next = this->rx_read_len;
+            MINBASECLI_TRACE_LINE_POINT(this, this->rx_read_len);
+            return true;
+        }
+
+        // Read a new chunk of received data
+        read_bytes = this->hal_iface_read_bulk(
+                (uint8_t*)(&(rx_read[this->rx_read_len])),
+                (rx_read_size - 1U) - this->rx_read_len);
+        if (read_bytes == 0U)
+        {   return false;   }
+        this->rx_read_len = this->rx_read_len + read_bytes;
+    }
+}
+
+/**
+ * @details
+ * This function search for a CR or LF character in the data of the read
+ * buffer that follows the last completed line.
+ */
+template <class HAL, class CFG>
+bool MINBASECLI_CORE<HAL, CFG>::iface_line_pending()
+{
+    for (size_t i = this->rx_line_next; i < this->rx_read_len; i++)
+    {
+        if ( (this->rx_read[i] == '\r') || (this->rx_read[i] == '\n') )
+        {   return true;   }
+    }
+
+    return false;
+}
+
+/**
+ * @details
+ * This function loops once through the line characters. Each word start is
+ * stored as the command (first word) or as the next argument, and the first
+ * separator character (space, CR or LF) after each word is replaced by a null
+ * character to terminate it. If the line has more arguments than the
+ * configuration MAX_TOKENS, the last argument holds the rest of the line
+ * (without its trailing separators), so no word is discarded.
+ */
+template <class HAL, class CFG>
+void MINBASECLI_CORE<HAL, CFG>::str_tokenize(char* str, const size_t str_len,
+        t_result* cli_result)
+{
+    size_t i = 0U;
+    size_t word_start = 0U;
+    bool first_word = true;
+
+    while (i < str_len)
+    {
+        // Skip separator characters
+        if ( (str[i] == ' ') || (str[i] == '\r') || (str[i] == '\n') )
+        {
+            i = i + 1U;
+            continue;
+        }
+
+        // Find the end of the word (or the end of the line for the last
+        // argument) and terminate it
+        word_start = i;
+        if ( (first_word == false) &&
+             (cli_result->argc == (CFG::MAX_TOKENS - 1U)) )
+        {
+            i = str_len;
+            while ( (str[i - 1U] == ' ') || (str[i - 1U] == '\r') ||
+                    (str[i - 1U] == '\n') )
+            {   i = i - 1U;   }
+        }
+        else
+        {
+            while ( (i < str_len) && (str[i] != ' ') && (str[i] != '\r') &&
+                    (str[i] != '\n') )
+            {   i = i + 1U;   }
+        }
+        str[i] = '\0';
+
+        // Store the word
+        if (first_word)
+        {
+            cli_result->cmd = &(str[word_start]);
+            cli_result->cmd_len =
+                    (typename CFG::t_word_len)(i - word_start);
+            first_word = false;
+        }
+        else
+        {
+            cli_result->argv[cli_result->argc] = &(str[word_start]);
+            cli_result->argv_len[cli_result->argc] =
+                    (typename CFG::t_word_len)(i - word_start);
+            cli_result->argc = cli_result->argc + 1U;
+        }
+        i = i + 1U;
+    }
+}
+
+/*****************************************************************************/
+
+/*****************************************************************************/
+
+#endif /* MINBASECLI_IMPL_H_ */
@@ -0,0 +1,311 @@
+
+/**
+ * @file    minbasecli_itoa.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * MINBASECLI integer to text conversion kernels. Numbers that fit in 32 bits
+ * are converted with 32 bits arithmetic only (64 bits divisions are library
+ * calls in 8 and 32 bits devices), decimal digits are got two at a time from
+ * a lookup table of digits pairs (one division by 100 for each pair), and
+ * the number of digits is got first so each digit is written directly in
+ * its final position (there is no string reverse pass). Power of two bases
+ * are converted with shifts and masks.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef MINBASECLI_ITOA_H_
+#define MINBASECLI_ITOA_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C/C++ libraries
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Program memory (flash) lookup table access for AVR
+#if defined(__AVR)
+    #include <avr/pgmspace.h>
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+/**
+ * @brief Size of a string buffer that can store any 64 bits number in octal
+ * or higher bases (22 octal digits and the null terminator).
+ */
+static const uint8_t MINBASECLI_ITOA_SIZE = 23U;
+
+// Lookup tables placement and access (program memory on AVR devices)
+#if defined(__AVR)
+    #define MINBASECLI_ITOA_LUT_ATTR PROGMEM
+    #define MINBASECLI_ITOA_LUT_READ(x) ((char)(pgm_read_byte(&(x))))
+#else
+    #define MINBASECLI_ITOA_LUT_ATTR
+    #define MINBASECLI_ITOA_LUT_READ(x) (x)
+#endif
+
+/**
+ * @brief Decimal digits pairs lookup table ("00" to "99").
+ */
+static const char MINBASECLI_ITOA_DEC_PAIRS[201] MINBASECLI_ITOA_LUT_ATTR =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/**
+ * @brief Digits lookup table for bases up to 16.
+ */
+static const char MINBASECLI_ITOA_DIGITS[17] MINBASECLI_ITOA_LUT_ATTR =
+    "0123456789abcdef";
+
+/*****************************************************************************/
+
+/* Conversion Functions */
+
+/**
+ * @brief Get the number of decimal digits of a 32 bits number.
+ * @param num The number.
+ * @return uint8_t The number of decimal digits.
+ */
+inline uint8_t minbasecli_u32_dec_len(const uint32_t num)
+{
+    uint32_t pow10 = 10U;
+    uint8_t len = 1U;
+
+    while ( (len < 10U) && (num >= pow10) )
+    {
+        pow10 = pow10 * 10U;
+        len = len + 1U;
+    }
+
+    return len;
+}
+
+/**
+ * @brief Write the decimal digits of a 32 bits number into the characters
+ * that precede a string position, two at a time from the digits pairs
+ * lookup table.
+ * @param num The number.
+ * @param str Pointer to the position that follows the last digit.
+ * @param num_digits Number of digits to write (leading zeros are written if
+ * the number has less digits).
+ */
+inline void minbasecli_u32toa_digits(uint32_t num, char* str,
+        uint8_t num_digits)
+{
+    uint32_t quot = 0U;
+    uint8_t pair = 0U;
+
+    while (num_digits >= 2U)
+    {
+        quot = num / 100U;
+        pair = (uint8_t)((num - (quot * 100U)) * 2U);
+        num = quot;
+        str = str - 2;
+        str[0] = MINBASECLI_ITOA_LUT_READ(MINBASECLI_ITOA_DEC_PAIRS[pair]);
+        str[1] = MINBASECLI_ITOA_LUT_READ(
+                MINBASECLI_ITOA_DEC_PAIRS[pair + 1U]);
+        num_digits = num_digits - 2U;
+    }
+    if (num_digits == 1U)
+    {
+        str = str - 1;
+        str[0] = (char)('0' + num);
+    }
+}
+
+/**
+ * @brief Convert a 32 bits unsigned number into a decimal string.
+ * @param num The number.
+ * @param str Pointer to the string buffer (it must have space for 11
+ * characters).
+ * @return uint8_t The number of digits written.
+ */
+inline uint8_t minbasecli_u32toa(const uint32_t num, char* str)
+{
+    uint8_t len = minbasecli_u32_dec_len(num);
+
+    minbasecli_u32toa_digits(num, &(str[len]), len);
+    str[len] = '\0';
+
+    return len;
+}
+
+/**
+ * @brief Convert a 64 bits unsigned number into a decimal string. Numbers
+ * that fit in 32 bits use the 32 bits conversion, and bigger ones are split
+ * in blocks of 8 decimal digits (with one or two 64 bits divisions).
+ * @param num The number.
+ * @param str Pointer to the string buffer (it must have space for 21
+ * characters).
+ * @return uint8_t The number of digits written.
+ */
+inline uint8_t minbasecli_u64toa_dec(const uint64_t num, char* str)
+{
+    uint64_t high = 0U;
+    uint32_t low = 0U;
+    uint32_t top = 0U;
+    uint32_t mid = 0U;
+    uint8_t len = 0U;
+
+    // 32 bits fast path
+    if (num <= 0xFFFFFFFFUL)
+    {   return minbasecli_u32toa((uint32_t)(num), str);   }
+
+    // Split the number in 8 decimal digits blocks
+    high = num / 100000000UL;
+    low = (uint32_t)(num - (high * 100000000UL));
+    if (high <= 0xFFFFFFFFUL)
+    {   len = minbasecli_u32toa((uint32_t)(high), str);   }
+    else
+    {
+        top = (uint32_t)(high / 100000000UL);
+        mid = (uint32_t)(high - ((uint64_t)(top) * 100000000UL));
+        len = minbasecli_u32toa(top, str);
+        minbasecli_u32toa_digits(mid, &(str[len + 8U]), 8U);
+        len = len + 8U;
+    }
+    minbasecli_u32toa_digits(low, &(str[len + 8U]), 8U);
+    len = len + 8U;
+    str[len] = '\0';
+
+    return len;
+}
+
+/**
+ * @brief Convert a 64 bits unsigned number into a string of a base from 2
+ * to 16 (lowercase digits). Power of two bases use shifts and masks (with
+ * 32 bits arithmetic if the number fits in 32 bits), and other ones use
+ * divisions.
+ * @param num The number.
+ * @param str Pointer to the string buffer.
+ * @param str_size Size of the string buffer.
+ * @param base Number base.
+ * @return uint8_t The number of digits written (0 if the base is not
+ * supported or the string buffer is too small).
+ */
+inline uint8_t minbasecli_u64toa(const uint64_t num, char* str,
+        const uint8_t str_size, const uint8_t base)
+{
+    uint64_t num64 = num;
+    uint32_t num32 = (uint32_t)(num);
+    uint8_t shift = 0U;
+    uint8_t len = 1U;
+    uint8_t pos = 0U;
+
+    if ( (base < 2U) || (base > 16U) )
+    {   return 0;   }
+
+    // Decimal base
+    if (base == 10U)
+    {
+        if ( (num <= 0xFFFFFFFFUL) &&
+             (str_size > minbasecli_u32_dec_len((uint32_t)(num))) )
+        {   return minbasecli_u32toa((uint32_t)(num), str);   }
+        if (str_size < 21U)
+        {   return 0;   }
+        return minbasecli_u64toa_dec(num, str);
+    }
+
+    // Other bases than power of two
+    if ((base & (base - 1U)) != 0U)
+    {
+        while (num64 >= base)
+        {
+            num64 = num64 / base;
+            len = len + 1U;
+        }
+        if (len >= str_size)
+        {   return 0;   }
+        num64 = num;
+        for (pos = len; pos > 0U; pos--)
+        {
+            str[pos - 1U] = MINBASECLI_ITOA_LUT_READ(
+                    MINBASECLI_ITOA_DIGITS[num64 % base]);
+            num64 = num64 / base;
+        }
+        str[len] = '\0';
+        return len;
+    }
+
+    // Power of two bases
+    while ((1U << shift) < base)
+    {   shift = shift + 1U;   }
+    if (num <= 0xFFFFFFFFUL)
+    {
+        while ((num32 >> shift) != 0U)
+        {
+            num32 = num32 >> shift;
+            len = len + 1U;
+        }
+        num32 = (uint32_t)(num);
+    }
+    else
+    {
+        while ((num64 >> shift) != 0U)
+        {
+            num64 = num64 >> shift;
+            len = len + 1U;
+        }
+    }
+    if (len >= str_size)
+    {   return 0;   }
+    if (num <= 0xFFFFFFFFUL)
+    {
+        for (pos = len; pos > 0U; pos--)
+        {
+            str[pos - 1U] = MINBASECLI_ITOA_LUT_READ(
+                    MINBASECLI_ITOA_DIGITS[num32 & (base - 1U)]);
+            num32 = num32 >> shift;
+        }
+    }
+    else
+    {
+        num64 = num;
+        for (pos = len; pos > 0U; pos--)
+        {
+            str[pos - 1U] = MINBASECLI_ITOA_LUT_READ(
+                    MINBASECLI_ITOA_DIGITS[num64 & (base - 1U)]);
+            num64 = num64 >> shift;
+        }
+    }
+    str[len] = '\0';
+
+    return len;
+}
+
+/*****************************************************************************/
+
+#endif /* MINBASECLI_ITOA_H_ */
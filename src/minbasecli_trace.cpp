@@ -0,0 +1,200 @@
+
+/**
+ * @file    minbasecli_trace.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * MINBASECLI Chrome trace backend (MINBASECLI_TRACE_CHROME, Linux). It
+ * writes the trace events to a Chrome trace JSON file (array format), with
+ * the monotonic clock timestamp and the thread of each event. Callbacks and
+ * output flushes are written as duration events, and the other events as
+ * instant events.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Build Selection (Chrome Trace Backend on Linux) */
+
+#if defined(MINBASECLI_TRACE_CHROME) && defined(__linux__)
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Header Interface
+#include "minbasecli_trace.h"
+
+// Device/Framework Libraries
+#include <pthread.h>
+#include <sys/syscall.h>    // SYS_gettid
+#include <unistd.h>         // getpid(), syscall()
+
+// Standard Libraries
+#include <stdio.h>
+#include <time.h>           // clock_gettime()
+
+/*****************************************************************************/
+
+/* Constants */
+
+// Maximum number of characters of the command texts written to the file
+static const size_t TRACE_MAX_STR = 32U;
+
+/*****************************************************************************/
+
+/* In-Scope Static Private */
+
+// Trace file (the events are not written if it is NULL) and its lock
+static FILE* trace_file = NULL;
+static pthread_mutex_t trace_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*****************************************************************************/
+
+/* Private Functions */
+
+/**
+ * @details
+ * This function copies a command text as a JSON string content, escaping
+ * the quotes and backslashes and replacing control characters.
+ */
+static void trace_json_str(char* json, const char* str)
+{
+    size_t len = 0U;
+
+    if (str == NULL)
+    {   str = "";   }
+
+    while ( (*str != '\0') && (len < TRACE_MAX_STR) )
+    {
+        if ( (*str == '"') || (*str == '\\') )
+        {
+            json[len] = '\\';
+            len = len + 1U;
+            json[len] = *str;
+        }
+        else if ((uint8_t)(*str) < 0x20U)
+        {   json[len] = '?';   }
+        else
+        {   json[len] = *str;   }
+        len = len + 1U;
+        str = str + 1;
+    }
+    json[len] = '\0';
+}
+
+/*****************************************************************************/
+
+/* Public Functions */
+
+/**
+ * @details
+ * This function opens the trace file and writes the start of the JSON
+ * events array.
+ */
+bool minbasecli_trace_chrome_open(const char* path)
+{
+    FILE* file = fopen(path, "w");
+
+    if (file == NULL)
+    {   return false;   }
+    fputs("[\n", file);
+
+    minbasecli_trace_chrome_close();
+    pthread_mutex_lock(&trace_mutex);
+    trace_file = file;
+    pthread_mutex_unlock(&trace_mutex);
+
+    return true;
+}
+
+/**
+ * @details
+ * This function ends the JSON events array with the process name metadata
+ * event (so the file is valid JSON) and closes the trace file.
+ */
+void minbasecli_trace_chrome_close()
+{
+    pthread_mutex_lock(&trace_mutex);
+    if (trace_file != NULL)
+    {
+        fprintf(trace_file, "{\"name\":\"process_name\",\"ph\":\"M\","
+                "\"pid\":%d,\"args\":{\"name\":\"minbasecli\"}}\n]\n",
+                (int)(getpid()));
+        fclose(trace_file);
+        trace_file = NULL;
+    }
+    pthread_mutex_unlock(&trace_mutex);
+}
+
+/**
+ * @details
+ * This function writes a trace event to the trace file with the monotonic
+ * clock timestamp (microseconds) and the ID of the current thread. The CLI
+ * object address is written as the event category, so the events of
+ * several CLIs can be filtered.
+ */
+void minbasecli_trace_event(const void* cli, const uint8_t event,
+        const uint32_t arg, const char* str)
+{
+    static const char* names[] =
+    {   "rx", "line", "parse", "callback", "callback", "tx", "tx"   };
+    static const char* args[] =
+    {   "bytes", "len", "argc", "argc", "argc", "bytes", "pending"   };
+    static const char phases[] = { 'i', 'i', 'i', 'B', 'E', 'B', 'E' };
+    char json_str[(2U * TRACE_MAX_STR) + 1U];
+    struct timespec now;
+    const char* name = NULL;
+
+    if (event > MINBASECLI_TRACE_TX_END)
+    {   return;   }
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    trace_json_str(json_str, str);
+
+    // Callbacks are named as their command
+    name = names[event];
+    if ( (event == MINBASECLI_TRACE_CB_ENTER) ||
+         (event == MINBASECLI_TRACE_CB_EXIT) )
+    {   name = json_str;   }
+
+    pthread_mutex_lock(&trace_mutex);
+    if (trace_file != NULL)
+    {
+        fprintf(trace_file, "{\"name\":\"%s\",\"cat\":\"cli_%p\","
+                "\"ph\":\"%c\",%s\"ts\":%lld.%03ld,\"pid\":%d,\"tid\":%ld,"
+                "\"args\":{\"%s\":%lu%s%s%s}},\n",
+                name, cli, phases[event],
+                (phases[event] == 'i') ? "\"s\":\"t\"," : "",
+                (long long)(now.tv_sec) * 1000000LL + (now.tv_nsec / 1000L),
+                (long)(now.tv_nsec % 1000L), (int)(getpid()),
+                (long)(syscall(SYS_gettid)), args[event],
+                (unsigned long)(arg), (str != NULL) ? ",\"cmd\":\"" : "",
+                json_str, (str != NULL) ? "\"" : "");
+    }
+    pthread_mutex_unlock(&trace_mutex);
+}
+
+/*****************************************************************************/
+
+#endif /* defined(MINBASECLI_TRACE_CHROME) && defined(__linux__) */
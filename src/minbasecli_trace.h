@@ -0,0 +1,202 @@
+
+/**
+ * @file    minbasecli_trace.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * MINBASECLI tracing hooks. The CLI core and HALs have trace points at the
+ * boundaries of a command handling (received bytes, line framing, parse,
+ * callback and output), so a slow response can be split into its queueing,
+ * parse, handler and output times. The trace points compile to nothing
+ * unless a tracing backend is enabled:
+ *
+ * - MINBASECLI_TRACE: Each trace point calls minbasecli_trace_event(), that
+ *   must be provided by the application (i.e. to store the events with a
+ *   cycle counter timestamp in a RAM buffer).
+ * - MINBASECLI_TRACE_CHROME (Linux): minbasecli_trace_event() is provided by
+ *   minbasecli_trace.cpp, that writes the events to a Chrome trace JSON file
+ *   (see minbasecli_trace_chrome_open()) to be shown in chrome://tracing or
+ *   Perfetto.
+ * - MINBASECLI_TRACE_USDT (Linux): Each trace point is a USDT probe of the
+ *   "minbasecli" provider (sys/sdt.h from systemtap-sdt-dev), that is just a
+ *   NOP instruction until a tracer (bpftrace, perf, SystemTap) attaches to
+ *   it. It can be enabled together with the other backends.
+ *
+ * Note: This file is included by minbasecli.h and by the HALs that have a
+ * reception buffer.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef MINBASECLI_TRACE_H_
+#define MINBASECLI_TRACE_H_
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C/C++ libraries
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*****************************************************************************/
+
+/* Build Options */
+
+// Chrome trace JSON file backend (Linux), it uses the trace hook
+#if defined(MINBASECLI_TRACE_CHROME) && !defined(__linux__)
+    #undef MINBASECLI_TRACE_CHROME
+#endif
+#if defined(MINBASECLI_TRACE_CHROME) && !defined(MINBASECLI_TRACE)
+    #define MINBASECLI_TRACE
+#endif
+
+// USDT probes backend (Linux)
+#if defined(MINBASECLI_TRACE_USDT) && !defined(__linux__)
+    #undef MINBASECLI_TRACE_USDT
+#endif
+#if defined(MINBASECLI_TRACE_USDT)
+    #include <sys/sdt.h>
+#endif
+
+/*****************************************************************************/
+
+/* Constants */
+
+/**
+ * @brief Trace events:
+ * RX - Bytes received into the HAL reception buffer (arg: bytes).
+ * LINE - Line framed from the received data (arg: line length).
+ * PARSE - Line tokens got (arg: number of arguments, str: command).
+ * CB_ENTER - Command callback call (arg: number of arguments, str: command).
+ * CB_EXIT - Command callback return (arg: number of arguments, str:
+ * command).
+ * TX_BEGIN - Output flush start (arg: pending bytes).
+ * TX_END - Output flush end (arg: bytes still pending).
+ */
+static const uint8_t MINBASECLI_TRACE_RX = 0U;
+static const uint8_t MINBASECLI_TRACE_LINE = 1U;
+static const uint8_t MINBASECLI_TRACE_PARSE = 2U;
+static const uint8_t MINBASECLI_TRACE_CB_ENTER = 3U;
+static const uint8_t MINBASECLI_TRACE_CB_EXIT = 4U;
+static const uint8_t MINBASECLI_TRACE_TX_BEGIN = 5U;
+static const uint8_t MINBASECLI_TRACE_TX_END = 6U;
+
+/*****************************************************************************/
+
+/* Trace Hook */
+
+#if defined(MINBASECLI_TRACE)
+
+/**
+ * @brief Trace event hook (provided by the application, or by the Chrome
+ * trace backend). It is called from the thread (or interrupt) where the
+ * event happens, so it must be fast and take its own timestamp.
+ * @param cli The CLI object of the event.
+ * @param event The event (MINBASECLI_TRACE_*).
+ * @param arg The event argument.
+ * @param str The event command text (NULL for events without it).
+ */
+void minbasecli_trace_event(const void* cli, const uint8_t event,
+        const uint32_t arg, const char* str);
+
+    #define MINBASECLI_TRACE_HOOK(cli, event, arg, str) \
+        minbasecli_trace_event((const void*)(cli), (event), \
+                (uint32_t)(arg), (str))
+#else
+    #define MINBASECLI_TRACE_HOOK(cli, event, arg, str) ((void)(0))
+#endif
+
+#if defined(MINBASECLI_TRACE_USDT)
+    #define MINBASECLI_TRACE_PROBE(probe, cli, arg, str) \
+        DTRACE_PROBE3(minbasecli, probe, (const void*)(cli), \
+                (uint32_t)(arg), (const char*)(str))
+#else
+    #define MINBASECLI_TRACE_PROBE(probe, cli, arg, str) ((void)(0))
+#endif
+
+#if defined(MINBASECLI_TRACE_CHROME)
+
+/**
+ * @brief Open the Chrome trace JSON file where the trace events are written
+ * (a previous one is closed).
+ * @param path The trace file path.
+ * @return true if the file has been opened.
+ * @return false if the file can't be opened.
+ */
+bool minbasecli_trace_chrome_open(const char* path);
+
+/**
+ * @brief Close the Chrome trace JSON file (the events are not written
+ * anymore).
+ */
+void minbasecli_trace_chrome_close();
+
+#endif
+
+/*****************************************************************************/
+
+/* Trace Points */
+
+// Trace point of an event (it compiles to nothing, without evaluating its
+// arguments, if there is no tracing backend enabled)
+#define MINBASECLI_TRACE_POINT(cli, event, probe, arg, str) \
+    do \
+    { \
+        MINBASECLI_TRACE_HOOK(cli, event, arg, str); \
+        MINBASECLI_TRACE_PROBE(probe, cli, arg, str); \
+    } while (0)
+
+#define MINBASECLI_TRACE_RX_POINT(cli, bytes) \
+    MINBASECLI_TRACE_POINT(cli, MINBASECLI_TRACE_RX, rx, bytes, \
+            (const char*)(NULL))
+
+#define MINBASECLI_TRACE_LINE_POINT(cli, len) \
+    MINBASECLI_TRACE_POINT(cli, MINBASECLI_TRACE_LINE, line, len, \
+            (const char*)(NULL))
+
+#define MINBASECLI_TRACE_PARSE_POINT(cli, argc, cmd) \
+    MINBASECLI_TRACE_POINT(cli, MINBASECLI_TRACE_PARSE, parse, argc, cmd)
+
+#define MINBASECLI_TRACE_CB_ENTER_POINT(cli, argc, cmd) \
+    MINBASECLI_TRACE_POINT(cli, MINBASECLI_TRACE_CB_ENTER, cb_enter, argc, \
+            cmd)
+
+#define MINBASECLI_TRACE_CB_EXIT_POINT(cli, argc, cmd) \
+    MINBASECLI_TRACE_POINT(cli, MINBASECLI_TRACE_CB_EXIT, cb_exit, argc, cmd)
+
+#define MINBASECLI_TRACE_TX_BEGIN_POINT(cli, bytes) \
+    MINBASECLI_TRACE_POINT(cli, MINBASECLI_TRACE_TX_BEGIN, tx_begin, bytes, \
+            (const char*)(NULL))
+
+#define MINBASECLI_TRACE_TX_END_POINT(cli, bytes) \
+    MINBASECLI_TRACE_POINT(cli, MINBASECLI_TRACE_TX_END, tx_end, bytes, \
+            (const char*)(NULL))
+
+/*****************************************************************************/
+
+#endif /* MINBASECLI_TRACE_H_ */
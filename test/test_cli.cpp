@@ -0,0 +1,622 @@
+/**
+ * @file    test_cli.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    16-10-2026
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * MINBASECLI core host tests. The CLI is built over the in-memory loopback
+ * HAL (MINBASECLI_HAL_LOOPBACK), so the received bytes, the output and the
+ * time are controlled by the test. It checks:
+ *
+ * - The printf() format engine against the C library snprintf().
+ * - Commands dispatch through the hash index and the commands trie (paths,
+ *   unique abbreviations, ambiguous abbreviations and duplicated commands).
+ * - Lines framing (LF, CR and CRLF End-Of-Line, lines split across several
+ *   received chunks).
+ * - The output policies when the TX buffer is full, and their counters.
+ * - Script lines execution through run_lines() and its statistics.
+ * - An asynchronous command driven through iface_ready() (if
+ *   MINBASECLI_CMD_ASYNC is defined).
+ * - A CLI with its own configuration (commands limit and dispatch).
+ *
+ * Each failed check is reported with its line, and the program exit code is
+ * the number of failed checks.
+ *
+ * @section LICENSE
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C/C++ libraries
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#if defined(MINBASECLI_CMD_ASYNC)
+    #include <unistd.h>
+#endif
+
+// MinBaseCLI Library (over the In-Memory Loopback HAL), with its
+// implementation for the CLIs with other configurations
+#include "minbasecli.h"
+#include "minbasecli_impl.h"
+
+#if !defined(MINBASECLI_HAL_LOOPBACK)
+    #error "test - MINBASECLI_HAL_LOOPBACK must be defined."
+#endif
+
+/*****************************************************************************/
+
+/* Constants & Defines */
+
+// Output capture buffer size
+static const size_t OUT_SIZE = 8192U;
+
+// Check a condition, reporting it if it fails
+#define CHECK(cond) \
+    do \
+    { \
+        num_checks = num_checks + 1U; \
+        if (!(cond)) \
+        { \
+            num_fails = num_fails + 1U; \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        } \
+    } while (0)
+
+// Check that the CLI snprintf() writes the same text and returns the same
+// length than the C library one
+#define CHECK_FMT(...) \
+    do \
+    { \
+        char expected[128]; \
+        char got[128]; \
+        int expected_len = snprintf(expected, sizeof(expected), \
+                __VA_ARGS__); \
+        int got_len = Cli.snprintf(got, sizeof(got), __VA_ARGS__); \
+        num_checks = num_checks + 1U; \
+        if ( (expected_len != got_len) || (strcmp(expected, got) != 0) ) \
+        { \
+            num_fails = num_fails + 1U; \
+            printf("FAIL %s:%d: %s -> \"%s\" (%d), expected \"%s\" " \
+                    "(%d)\n", __FILE__, __LINE__, #__VA_ARGS__, got, \
+                    got_len, expected, expected_len); \
+        } \
+    } while (0)
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+// CLI under test
+static MINBASECLI Cli;
+
+// CLI with its own configuration (two commands and three arguments at most)
+typedef MINBASECLI_CFG< MINBASECLI_CONFIG<32, 16, 64, 2, 32, 3> > SMALL_CLI;
+static SMALL_CLI SmallCli;
+
+// Output capture buffer
+static uint8_t out[OUT_SIZE];
+
+// Checks counters
+static uint32_t num_checks = 0U;
+static uint32_t num_fails = 0U;
+
+// Last command callback call (command name and arguments joined with
+// spaces) and number of callbacks calls
+static char last_call[128];
+static uint32_t num_calls = 0U;
+
+// Text written by the flood command and its number of bytes
+static char flood_text[2048];
+static size_t flood_len = 0U;
+
+/*****************************************************************************/
+
+/* Auxiliary Functions */
+
+/**
+ * @details
+ * This function stores a command callback call (the command name and its
+ * arguments).
+ */
+static void record_call(const char* name, int argc, char* argv[])
+{
+    size_t len = 0U;
+
+    len = (size_t)(snprintf(last_call, sizeof(last_call), "%s", name));
+    for (int i = 0; (i < argc) && (len < sizeof(last_call)); i++)
+    {
+        len = len + (size_t)(snprintf(&(last_call[len]),
+                sizeof(last_call) - len, " %s", argv[i]));
+    }
+    num_calls = num_calls + 1U;
+}
+
+/**
+ * @details
+ * This function sets a received input and handles it with run() calls
+ * until all of it has been handled (waiting for its bytes to arrive if a
+ * serial line speed is simulated), clearing the last callback call before.
+ */
+static void receive(const char* input)
+{
+    last_call[0] = '\0';
+    Cli.set_input(input);
+    while (Cli.get_input_pending() > 0U)
+    {   Cli.run_wait(1000U);   }
+    while (Cli.run())
+    {}
+}
+
+/**
+ * @details
+ * This function checks if the captured output contains a text.
+ */
+static bool output_has(const char* text)
+{
+    size_t text_len = strlen(text);
+    size_t out_len = Cli.get_output_len();
+
+    for (size_t i = 0U; (i + text_len) <= out_len; i++)
+    {
+        if (memcmp(&(out[i]), text, text_len) == 0)
+        {   return true;   }
+    }
+    return false;
+}
+
+/*****************************************************************************/
+
+/* Commands Callbacks */
+
+static void cmd_led_on(MINBASECLI* Cli, int argc, char* argv[])
+{   record_call("led on", argc, argv);   }
+
+static void cmd_led_off(MINBASECLI* Cli, int argc, char* argv[])
+{   record_call("led off", argc, argv);   }
+
+static void cmd_net_if_stats(MINBASECLI* Cli, int argc, char* argv[])
+{   record_call("net if stats", argc, argv);   }
+
+static void cmd_version(MINBASECLI* Cli, int argc, char* argv[])
+{   record_call("version", argc, argv);   }
+
+static void cmd_set(MINBASECLI* Cli, int argc, char* argv[])
+{   record_call("set", argc, argv);   }
+
+static void cmd_show(MINBASECLI* Cli, int argc, char* argv[])
+{   record_call("show", argc, argv);   }
+
+static void cmd_echo(MINBASECLI* Cli, int argc, char* argv[])
+{
+    record_call("echo", argc, argv);
+    Cli->printf("ok\n");
+}
+
+/**
+ * @details
+ * This function writes lines of 15 characters, as many as the number of its
+ * argument, in a single block, so it does not fit in the TX buffer.
+ */
+static void cmd_flood(MINBASECLI* Cli, int argc, char* argv[])
+{
+    int num_lines = 0;
+
+    flood_len = 0U;
+    if (argc > 0)
+    {   sscanf(argv[0], "%d", &num_lines);   }
+    for (int i = 0; i < num_lines; i++)
+    {
+        flood_len = flood_len + (size_t)(::snprintf(&(flood_text[flood_len]),
+                sizeof(flood_text) - flood_len, "line %09d\n", i));
+    }
+    Cli->printf("%s", flood_text);
+}
+
+#if defined(MINBASECLI_CMD_ASYNC)
+static void cmd_work(MINBASECLI* Cli, int argc, char* argv[])
+{   Cli->printf("worked %d\n", argc);   }
+#endif
+
+static void cmd_small(SMALL_CLI* Cli, int argc, char* argv[])
+{   record_call("small", argc, argv);   }
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details
+ * This function checks the integer, character, string, pointer and floating
+ * point conversions, with the flags, width, precision and length modifiers,
+ * against the C library snprintf().
+ */
+static void test_format()
+{
+    int x = 0;
+
+    // Integers
+    CHECK_FMT("%d|%i|%u", 0, -42, 42U);
+    CHECK_FMT("%d|%d", 2147483647, (-2147483647 - 1));
+    CHECK_FMT("%5d|%-5d|%05d|%+d|% d", 42, 42, -42, 42, 42);
+    // The ignored '0' flag with precision is checked on purpose
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat"
+    CHECK_FMT("%.3d|%8.3d|%-8.3d|%.0d|%08.3d", 7, -7, 7, 0, 7);
+#pragma GCC diagnostic pop
+    CHECK_FMT("%x|%X|%#x|%#X|%#o|%o", 255U, 255U, 255U, 255U, 8U, 8U);
+    CHECK_FMT("%#.3o|%#x|%#08x|%-#8x|", 8U, 0U, 255U, 255U);
+    CHECK_FMT("%hhd|%hhu|%hd|%hu", 300, 300, 70000, 70000);
+    CHECK_FMT("%ld|%lu|%lx", -123456789L, 123456789UL, 0xDEADBEEFUL);
+    CHECK_FMT("%lld|%llu|%llx", (-9223372036854775807LL - 1LL),
+            18446744073709551615ULL, 0x0123456789ABCDEFULL);
+    CHECK_FMT("%zu|%zd|%zx", (size_t)(4096U), (ssize_t)(-1), (size_t)(255U));
+    CHECK_FMT("%jd|%td", (intmax_t)(-5), (ptrdiff_t)(12));
+    CHECK_FMT("%*d|%-*d|%.*d", 6, 42, 6, 42, 4, 42);
+
+    // Characters, strings and pointers
+    CHECK_FMT("%c|%3c|%-3c|", 'a', 'b', 'c');
+    CHECK_FMT("%s|%10s|%-10s|%.3s|%10.2s|", "text", "text", "text", "text",
+            "text");
+    CHECK_FMT("%p|%20p|%-20p|", (void*)(&x), (void*)(&x), (void*)(&x));
+    // The "%5%" conversion (a width for a literal '%') is checked on purpose
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat"
+    CHECK_FMT("100%%|%5%|");
+#pragma GCC diagnostic pop
+
+#if defined(MINBASECLI_PRINTF_FLOAT)
+    // Floating point numbers
+    CHECK_FMT("%f|%f|%f", 0.0, 1.5, -2.25);
+    CHECK_FMT("%.2f|%.0f|%.0f|%.0f|%#.0f", 3.14159, 0.5, 1.5, 2.5, 2.0);
+    CHECK_FMT("%10.3f|%-10.3f|%010.3f|%+.1f|% .1f", 3.14159, -3.14159,
+            -3.14159, 2.25, 2.25);
+    CHECK_FMT("%.6f|%.6f|%.3f", 123456.789012, 0.000001, 999.9995);
+    CHECK_FMT("%f|%F|%f", 1.0 / 0.0, -1.0 / 0.0, 4294967296.125);
+#endif
+
+    // Truncated output (returns the full length)
+    CHECK_FMT("%s %d", "a long enough text to be truncated", 12345);
+}
+
+/**
+ * @details
+ * This function checks the commands lookup through the hash index (single
+ * word commands) and the commands trie (commands paths and unique
+ * abbreviations), and that a duplicated command is rejected.
+ */
+static void test_dispatch()
+{
+    // Duplicated commands are rejected
+    CHECK(Cli.add_cmd("version", cmd_version, "Shows version."));
+    CHECK(Cli.add_cmd("version", cmd_version, "Shows version.") == false);
+    CHECK(Cli.add_cmd("set", cmd_set, "Sets a value."));
+    CHECK(Cli.add_cmd("show", cmd_show, "Shows a value."));
+    CHECK(Cli.add_cmd("led on", cmd_led_on, "Turns on a LED."));
+    CHECK(Cli.add_cmd("led off", cmd_led_off, "Turns off a LED."));
+    CHECK(Cli.add_cmd("led on", cmd_led_off, "Duplicated.") == false);
+    CHECK(Cli.add_cmd("net if stats", cmd_net_if_stats, "Shows stats."));
+    CHECK(Cli.add_cmd("echo", cmd_echo, "Answers ok."));
+    CHECK(Cli.add_cmd("flood", cmd_flood, "Writes lines."));
+
+    // Full commands and arguments
+    receive("version\n");
+    CHECK(strcmp(last_call, "version") == 0);
+    receive("set speed 10\n");
+    CHECK(strcmp(last_call, "set speed 10") == 0);
+    receive("led on 3\n");
+    CHECK(strcmp(last_call, "led on 3") == 0);
+    receive("net if stats eth0\n");
+    CHECK(strcmp(last_call, "net if stats eth0") == 0);
+
+    // Unique abbreviations
+    receive("led of\n");
+    CHECK(strcmp(last_call, "led off") == 0);
+    receive("vers\n");
+    CHECK(strcmp(last_call, "version") == 0);
+    receive("n i s\n");
+    CHECK(strcmp(last_call, "net if stats") == 0);
+    receive("sh x\n");
+    CHECK(strcmp(last_call, "show x") == 0);
+
+    // Ambiguous abbreviations and unknown commands
+    receive("led o\n");
+    CHECK(last_call[0] == '\0');
+    receive("s\n");
+    CHECK(last_call[0] == '\0');
+    receive("reboot\n");
+    CHECK(last_call[0] == '\0');
+}
+
+/**
+ * @details
+ * This function checks the lines framing with each End-Of-Line type, with
+ * several lines in a single received chunk and with lines split across
+ * several chunks (CRLF split between chunks is a single End-Of-Line).
+ */
+static void test_framing()
+{
+    uint32_t calls = 0U;
+
+    // LF, CR and CRLF End-Of-Line
+    receive("echo lf\n");
+    CHECK(strcmp(last_call, "echo lf") == 0);
+    receive("echo cr\r");
+    CHECK(strcmp(last_call, "echo cr") == 0);
+    receive("echo crlf\r\n");
+    CHECK(strcmp(last_call, "echo crlf") == 0);
+
+    // Several lines in a single chunk
+    calls = num_calls;
+    receive("echo 1\necho 2\r\necho 3\r");
+    CHECK(num_calls == (calls + 3U));
+    CHECK(strcmp(last_call, "echo 3") == 0);
+
+    // A line split across several chunks
+    calls = num_calls;
+    receive("ec");
+    CHECK(num_calls == calls);
+    receive("ho sp");
+    CHECK(num_calls == calls);
+    receive("lit\n");
+    CHECK(num_calls == (calls + 1U));
+    CHECK(strcmp(last_call, "echo split") == 0);
+
+    // CRLF split between chunks (the LF is not an empty line)
+    calls = num_calls;
+    Cli.clear_output();
+    receive("echo a\r");
+    receive("\necho b\n");
+    CHECK(num_calls == (calls + 2U));
+    CHECK(strcmp(last_call, "echo b") == 0);
+    CHECK(Cli.get_output_len() == strlen("# echo a\nok\n# echo b\nok\n"));
+    CHECK(memcmp(out, "# echo a\nok\n# echo b\nok\n",
+            Cli.get_output_len()) == 0);
+}
+
+/**
+ * @details
+ * This function checks each output policy with a command that writes more
+ * output than the TX buffer size over a slow simulated serial line: all the
+ * output is sent with BLOCK, the newest or oldest bytes are dropped with
+ * DROP_NEWEST and DROP_OLDEST, and the rest of the response is truncated
+ * with TRUNCATE (but not the next one). The sent bytes plus the dropped or
+ * truncated ones are the written bytes.
+ */
+static void test_tx_policies()
+{
+    const char* input = "flood 64\n";
+    const size_t echo_len = strlen("# flood 64\n");
+    size_t written = 0U;
+    uint64_t sent = 0U;
+    uint32_t dropped = 0U;
+    uint32_t truncated = 0U;
+
+    Cli.set_baud_rate(9600U);
+
+    // BLOCK: All the output is sent
+    CHECK(Cli.set_tx_policy(MINBASECLI_TX_POLICY_BLOCK));
+    Cli.clear_output();
+    sent = Cli.get_output_bytes();
+    receive(input);
+    Cli.flush();
+    written = echo_len + flood_len;
+    CHECK(written > MINBASECLI_MAX_TX_SIZE);
+    CHECK((Cli.get_output_bytes() - sent) == written);
+    CHECK(Cli.get_tx_dropped_bytes() == 0U);
+    CHECK(output_has("line 000000063\n"));
+
+    // DROP_NEWEST: The first output is sent
+    CHECK(Cli.set_tx_policy(MINBASECLI_TX_POLICY_DROP_NEWEST));
+    Cli.clear_output();
+    sent = Cli.get_output_bytes();
+    dropped = Cli.get_tx_dropped_bytes();
+    receive(input);
+    Cli.flush();
+    dropped = Cli.get_tx_dropped_bytes() - dropped;
+    CHECK(dropped > 0U);
+    CHECK(((Cli.get_output_bytes() - sent) + dropped) == written);
+    CHECK(output_has("# flood 64\nline 000000000\n"));
+    CHECK(output_has("line 000000063\n") == false);
+
+    // DROP_OLDEST: The last output is sent
+    CHECK(Cli.set_tx_policy(MINBASECLI_TX_POLICY_DROP_OLDEST));
+    Cli.clear_output();
+    sent = Cli.get_output_bytes();
+    dropped = Cli.get_tx_dropped_bytes();
+    receive(input);
+    Cli.flush();
+    dropped = Cli.get_tx_dropped_bytes() - dropped;
+    CHECK(dropped > 0U);
+    CHECK(((Cli.get_output_bytes() - sent) + dropped) == written);
+    CHECK(output_has("line 000000063\n"));
+
+    // TRUNCATE: The rest of the response is discarded, but not the next
+    // response
+    CHECK(Cli.set_tx_policy(MINBASECLI_TX_POLICY_TRUNCATE));
+    Cli.clear_output();
+    sent = Cli.get_output_bytes();
+    dropped = Cli.get_tx_dropped_bytes();
+    truncated = Cli.get_tx_truncated_bytes();
+    receive(input);
+    Cli.flush();
+    truncated = Cli.get_tx_truncated_bytes() - truncated;
+    CHECK(truncated > 0U);
+    CHECK(Cli.get_tx_dropped_bytes() == dropped);
+    CHECK(((Cli.get_output_bytes() - sent) + truncated) == written);
+    CHECK(output_has("line 000000063\n") == false);
+    Cli.clear_output();
+    receive("echo next\n");
+    Cli.flush();
+    CHECK(output_has("# echo next\nok\n"));
+
+    CHECK(Cli.set_tx_policy(MINBASECLI_TX_POLICY_BLOCK));
+    CHECK(Cli.set_tx_policy(MINBASECLI_TX_POLICY_TRUNCATE + 1U) == false);
+    Cli.set_baud_rate(0U);
+}
+
+/**
+ * @details
+ * This function checks the script lines execution: LF and CRLF lines,
+ * skipped empty and comment lines, unknown commands, too long lines, and a
+ * last line without End-Of-Line that is kept until the data end.
+ */
+static void test_run_lines()
+{
+    static const char script[] =
+        "# Script\n"
+        "echo 1\n"
+        "\n"
+        "echo 2\r\n"
+        "unknown command\n"
+        "   \n"
+        "echo 3";
+    char long_line[MINBASECLI_MAX_READ_SIZE + 16U];
+    t_cli_script_stats stats;
+    size_t used = 0U;
+    uint32_t calls = num_calls;
+
+    memset(&stats, 0, sizeof(stats));
+
+    // The last line without End-Of-Line is kept for the next call
+    used = Cli.run_lines(script, strlen(script), false, &stats);
+    CHECK(used == (strlen(script) - strlen("echo 3")));
+    CHECK(num_calls == (calls + 2U));
+    CHECK(stats.lines == 6U);
+    CHECK(stats.commands == 2U);
+    CHECK(stats.unknown == 1U);
+    CHECK(stats.truncated == 0U);
+
+    // The last line is executed at the data end
+    used = Cli.run_lines(&(script[used]), strlen(script) - used, true,
+            &stats);
+    CHECK(used == strlen("echo 3"));
+    CHECK(num_calls == (calls + 3U));
+    CHECK(strcmp(last_call, "echo 3") == 0);
+    CHECK(stats.lines == 7U);
+    CHECK(stats.commands == 3U);
+
+    // Too long lines are truncated
+    memset(long_line, 'x', sizeof(long_line));
+    memcpy(long_line, "echo ", 5U);
+    long_line[sizeof(long_line) - 1U] = '\n';
+    Cli.run_lines(long_line, sizeof(long_line), true, &stats);
+    CHECK(stats.lines == 8U);
+    CHECK(stats.commands == 4U);
+    CHECK(stats.truncated == 1U);
+}
+
+#if defined(MINBASECLI_CMD_ASYNC)
+
+/**
+ * @details
+ * This function checks an asynchronous command driven through iface_ready()
+ * (the event loop path): the command is queued, and its response is sent by
+ * a later iface_ready() call once its worker thread has executed it.
+ */
+static void test_async()
+{
+    uint32_t tries = 0U;
+
+    CHECK(Cli.add_cmd_async("work", cmd_work, "Works in background."));
+    CHECK(Cli.add_cmd_async("work", cmd_work, "Duplicated.") == false);
+
+    Cli.clear_output();
+    Cli.set_input("work 1 2\n");
+    Cli.iface_ready();
+    CHECK(output_has("[1] queued\n"));
+
+    // Wait for the worker thread (at most one second, the loopback HAL wait
+    // just advances its virtual clock)
+    while ( (Cli.get_async_pending() > 0U) && (tries < 1000U) )
+    {
+        usleep(1000U);
+        Cli.iface_ready();
+        tries = tries + 1U;
+    }
+    CHECK(Cli.get_async_pending() == 0U);
+    CHECK(output_has("[1] worked 2\n[1] done\n"));
+    Cli.stop_async();
+}
+
+#endif
+
+/**
+ * @details
+ * This function checks a CLI with its own configuration: its commands and
+ * arguments limits and its commands dispatch (paths and abbreviations) are
+ * the ones of its configuration, not the default CLI ones.
+ */
+static void test_config()
+{
+    static uint8_t small_out[256];
+
+    SmallCli.setup();
+    SmallCli.set_output(small_out, sizeof(small_out));
+    CHECK(SmallCli.add_cmd("fan on", cmd_small, "Turns on the fan."));
+    CHECK(SmallCli.add_cmd("fan off", cmd_small, "Turns off the fan."));
+    CHECK(SmallCli.add_cmd("reset", cmd_small, "Resets.") == false);
+
+    last_call[0] = '\0';
+    SmallCli.set_input("f of 2\n");
+    while (SmallCli.run())
+    {}
+    CHECK(strcmp(last_call, "small 2") == 0);
+
+    // The last argument holds the rest of a line with more arguments
+    last_call[0] = '\0';
+    SmallCli.set_input("fan on 1 2  3 \n");
+    while (SmallCli.run())
+    {}
+    CHECK(strcmp(last_call, "small 1 2  3") == 0);
+    CHECK(sizeof(SMALL_CLI::t_result) < sizeof(MINBASECLI::t_result));
+    CHECK(sizeof(SMALL_CLI) < sizeof(MINBASECLI));
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    Cli.setup();
+    Cli.set_output(out, sizeof(out));
+
+    test_format();
+    test_dispatch();
+    test_framing();
+    test_tx_policies();
+    test_run_lines();
+#if defined(MINBASECLI_CMD_ASYNC)
+    test_async();
+#endif
+    test_config();
+
+    printf("%lu checks, %lu failed\n", (unsigned long)(num_checks),
+            (unsigned long)(num_fails));
+
+    return (int)(num_fails);
+}
+
+/*****************************************************************************/
@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+'''
+@file    minbasecli_log.py
+@author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+@date    16-10-2026
+@version 1.0.0
+
+@section DESCRIPTION
+
+MINBASECLI deferred log records decoder. It gets the format strings table
+from the "minbasecli_log" section of the device firmware ELF file (generated
+at build time by the MINBASECLI_LOG() calls), reads the CLI output (a file,
+a serial port device or the standard input), and renders the binary log
+records into text with the C printf() semantics. The rest of the CLI output
+(normal text) is written as it is.
+
+Usage:
+    minbasecli_log.py firmware.elf [input]
+    minbasecli_log.py --table firmware.elf
+
+@section LICENSE
+
+Copyright (c) 2026 Jose Miguel Rios Rubio. All right reserved.
+
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public
+License along with this library; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+'''
+
+###############################################################################
+
+### Libraries ###
+
+import argparse
+import re
+import struct
+import sys
+
+###############################################################################
+
+### Constants ###
+
+# Format strings section name
+LOG_SECTION = "minbasecli_log"
+
+# Records framing (see MINBASECLI_LOG_SYNC in minbasecli.h)
+LOG_SYNC = 0xA5
+LOG_HEADER_SIZE = 8
+
+# Arguments type tags
+LOG_TAG_INT = 0x10
+LOG_TAG_UINT = 0x20
+LOG_TAG_FLOAT = 0x30
+LOG_TAG_STR = 0x40
+LOG_TAG_PTR = 0x50
+
+# printf() conversion specification
+FMT_CONV = re.compile(
+    r"%([-+ #0]*)(\d+|\*)?(?:\.(\d*|\*))?(hh|h|ll|l|j|z|t|L)?"
+    r"([diouxXcspfFeEgGaA%])")
+
+###############################################################################
+
+### ELF File ###
+
+def elf_log_table(elf_path):
+    '''
+    Get the byte order and the format strings table (offset in the log
+    section to string) from an ELF file.
+    '''
+    with open(elf_path, "rb") as elf_file:
+        elf = elf_file.read()
+    if elf[0:4] != b"\x7fELF":
+        raise ValueError("{} is not an ELF file".format(elf_path))
+    endian = "<" if elf[5] == 1 else ">"
+    if elf[4] == 2:
+        shoff, = struct.unpack_from(endian + "Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(
+            endian + "HHH", elf, 0x3A)
+        sh_fmt = endian + "IIQQQQ"
+    else:
+        shoff, = struct.unpack_from(endian + "I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(
+            endian + "HHH", elf, 0x2E)
+        sh_fmt = endian + "IIIIII"
+    sections = []
+    for i in range(shnum):
+        sections.append(
+            struct.unpack_from(sh_fmt, elf, shoff + (i * shentsize)))
+    names_offset = sections[shstrndx][4]
+    for name, _, _, _, offset, size in sections:
+        name_end = elf.index(b"\0", names_offset + name)
+        if elf[names_offset + name:name_end].decode() != LOG_SECTION:
+            continue
+        data = elf[offset:offset + size]
+        table = {}
+        str_start = 0
+        while str_start < len(data):
+            str_end = data.find(b"\0", str_start)
+            if str_end < 0:
+                str_end = len(data)
+            table[str_start] = data[str_start:str_end].decode("latin-1")
+            str_start = str_end + 1
+        return endian, table
+    raise ValueError("{} has no {} section".format(elf_path, LOG_SECTION))
+
+###############################################################################
+
+### Records Decoding ###
+
+def record_args(endian, data):
+    '''
+    Get the arguments of a record payload as (tag, size, value) tuples.
+    '''
+    int_fmt = {1: "b", 2: "h", 4: "i", 8: "q"}
+    float_fmt = {4: "f", 8: "d"}
+    args = []
+    pos = 0
+    while pos < len(data):
+        tag = data[pos] & 0xF0
+        size = data[pos] & 0x0F
+        pos = pos + 1
+        if tag == LOG_TAG_STR:
+            size = data[pos]
+            value = data[pos + 1:pos + 1 + size].decode("latin-1")
+            pos = pos + 1 + size
+        elif (tag == LOG_TAG_FLOAT) and (size in float_fmt):
+            value, = struct.unpack_from(endian + float_fmt[size], data, pos)
+            pos = pos + size
+        elif size in int_fmt:
+            value_fmt = int_fmt[size]
+            if tag != LOG_TAG_INT:
+                value_fmt = value_fmt.upper()
+            value, = struct.unpack_from(endian + value_fmt, data, pos)
+            pos = pos + size
+        else:
+            break
+        args.append((tag, size, value))
+    return args
+
+
+def render(fstr, args):
+    '''
+    Render a format string with the record arguments (C printf() semantics,
+    missing arguments are shown as "?").
+    '''
+    args = list(args)
+
+    def next_arg():
+        return args.pop(0) if args else None
+
+    def conv(match):
+        flags, width, precision, _, conv_type = match.groups()
+        if conv_type == "%":
+            return "%"
+        if width == "*":
+            arg = next_arg()
+            width = str(arg[2]) if arg else ""
+            if width.startswith("-"):
+                flags, width = flags + "-", width[1:]
+        if precision == "*":
+            arg = next_arg()
+            precision = str(arg[2]) if (arg and arg[2] >= 0) else None
+        spec = "%" + flags + (width or "")
+        if precision is not None:
+            spec = spec + "." + (precision or "0")
+        arg = next_arg()
+        if arg is None:
+            return "?"
+        tag, size, value = arg
+        try:
+            if conv_type in "di":
+                return (spec + "d") % int(value)
+            if conv_type in "ouxX":
+                if isinstance(value, int) and value < 0:
+                    value = value & ((1 << (8 * size)) - 1)
+                return (spec + conv_type.replace("u", "d")) % value
+            if conv_type == "c":
+                return (spec + "c") % chr(value & 0xFF)
+            if conv_type == "s":
+                return (spec + "s") % value
+            if conv_type == "p":
+                return (spec + "s") % "0x{:x}".format(value)
+            if conv_type in "aA":
+                return float(value).hex()
+            return (spec + conv_type) % float(value)
+        except (TypeError, ValueError):
+            return "?"
+
+    return FMT_CONV.sub(conv, fstr)
+
+
+def decode(endian, table, stream, out):
+    '''
+    Decode the CLI output from a stream, writing the normal text as it is
+    and the log records rendered as timestamped lines.
+    '''
+    buf = b""
+    while True:
+        chunk = stream.read1(4096) if hasattr(stream, "read1") \
+            else stream.read(4096)
+        if not chunk:
+            break
+        buf = buf + chunk
+        while buf:
+            sync = buf.find(bytes([LOG_SYNC]))
+            if sync < 0:
+                out.write(buf.decode("latin-1"))
+                buf = b""
+                break
+            if sync > 0:
+                out.write(buf[:sync].decode("latin-1"))
+                buf = buf[sync:]
+            # Wait for the full record
+            if (len(buf) < 2) or (len(buf) < buf[1] + 3):
+                break
+            payload = buf[2:buf[1] + 2]
+            checksum = buf[buf[1] + 2]
+            if (len(payload) < LOG_HEADER_SIZE - 2) or \
+               ((sum(payload) & 0xFF) != checksum):
+                # Not a record, the sync byte is written as text
+                out.write(buf[:1].decode("latin-1"))
+                buf = buf[1:]
+                continue
+            fstr_id, time_us = struct.unpack_from(endian + "HI", payload, 0)
+            fstr = table.get(fstr_id)
+            if fstr is None:
+                text = "<unknown log format string {}>\n".format(fstr_id)
+            else:
+                text = render(fstr, record_args(endian, payload[6:]))
+            out.write("[{:>6}.{:06}] {}".format(
+                time_us // 1000000, time_us % 1000000, text))
+            buf = buf[buf[1] + 3:]
+        out.flush()
+    if buf:
+        out.write(buf.decode("latin-1"))
+
+###############################################################################
+
+### Main Function ###
+
+def main(argv):
+    '''
+    Main Function.
+    '''
+    parser = argparse.ArgumentParser(
+        description="MINBASECLI deferred log records decoder.")
+    parser.add_argument("elf", help="Device firmware ELF file.")
+    parser.add_argument("input", nargs="?",
+        help="CLI output file or serial port device (default: stdin).")
+    parser.add_argument("--table", action="store_true",
+        help="Show the format strings table and exit.")
+    args = parser.parse_args(argv)
+    try:
+        endian, table = elf_log_table(args.elf)
+    except (OSError, ValueError) as error:
+        print("Error: {}".format(error), file=sys.stderr)
+        return 1
+    if args.table:
+        # Alignment padding between strings is not shown
+        for fstr_id in sorted(table):
+            if not table[fstr_id]:
+                continue
+            print("{:5} {}".format(fstr_id, repr(table[fstr_id])))
+        return 0
+    if args.input is None:
+        decode(endian, table, sys.stdin.buffer, sys.stdout)
+    else:
+        with open(args.input, "rb", buffering=0) as stream:
+            decode(endian, table, stream, sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    try:
+        sys.exit(main(sys.argv[1:]))
+    except KeyboardInterrupt:
+        sys.exit(0)